@@ -0,0 +1,125 @@
+#include "AmcpConnection.h"
+
+#include <cstring>
+
+#include <QtCore/QMetaObject>
+#include <QtCore/QThread>
+
+#include <QtNetwork/QTcpSocket>
+
+AmcpConnection::AmcpConnection(QObject* parent)
+    : QObject(parent),
+      writeQueue(4096), writeScheduled(false)
+{
+    this->socket = new QTcpSocket(this);
+
+    QObject::connect(this->socket, SIGNAL(readyRead()), this, SLOT(readMessage()));
+    QObject::connect(this->socket, SIGNAL(connected()), this, SLOT(setConnected()));
+    QObject::connect(this->socket, SIGNAL(connected()), this, SIGNAL(connected()));
+    QObject::connect(this->socket, SIGNAL(disconnected()), this, SIGNAL(disconnected()));
+}
+
+void AmcpConnection::submit(const QByteArray& message)
+{
+    // Called from the GUI thread. Only the first message of a burst wakes up the I/O thread.
+    while (!this->writeQueue.push(message))
+    {
+        QMetaObject::invokeMethod(this, "writeMessages", Qt::QueuedConnection);
+        QThread::yieldCurrentThread();
+    }
+
+    if (!this->writeScheduled.exchange(true))
+        QMetaObject::invokeMethod(this, "writeMessages", Qt::QueuedConnection);
+}
+
+void AmcpConnection::connectToHost(const QString& address, int port)
+{
+    this->socket->connectToHost(address, port);
+}
+
+void AmcpConnection::disconnectFromHost()
+{
+    this->socket->blockSignals(true);
+    this->socket->disconnectFromHost();
+    this->socket->blockSignals(false);
+
+    resetBuffer();
+}
+
+void AmcpConnection::setConnected()
+{
+    // Disable Nagle, commands are already coalesced into batches before they are submitted.
+    this->socket->setSocketOption(QAbstractSocket::LowDelayOption, 1);
+
+    resetBuffer();
+}
+
+void AmcpConnection::resetBuffer()
+{
+    this->buffer.clear();
+    this->scanPosition = 0;
+}
+
+void AmcpConnection::writeMessages()
+{
+    this->writeScheduled.store(false);
+
+    bool written = false;
+
+    QByteArray message;
+    while (this->writeQueue.pop(message))
+    {
+        if (this->socket->state() != QAbstractSocket::ConnectedState)
+            continue; // The device will fail the pending command when it sees the disconnect.
+
+        this->socket->write(message);
+        written = true;
+    }
+
+    if (written)
+        this->socket->flush();
+}
+
+void AmcpConnection::readMessage()
+{
+    QStringList lines;
+    while (this->socket->bytesAvailable())
+    {
+        this->buffer.append(this->socket->readAll());
+
+        // Scan the raw bytes for CRLF, resuming where the previous chunk stopped. Only complete lines are
+        // decoded, so multibyte UTF-8 sequences split across reads are never seen in isolation.
+        const char* data = this->buffer.constData();
+        const int size = this->buffer.size();
+
+        int lineStart = 0;
+        while (this->scanPosition < size)
+        {
+            const char* found = static_cast<const char*>(std::memchr(data + this->scanPosition, '\n', size - this->scanPosition));
+            if (found == nullptr)
+            {
+                this->scanPosition = size;
+                break;
+            }
+
+            const int position = found - data;
+            this->scanPosition = position + 1;
+
+            if (position == 0 || data[position - 1] != '\r')
+                continue; // A bare LF is part of the line.
+
+            lines.append(QString::fromUtf8(data + lineStart, position - 1 - lineStart));
+            lineStart = position + 1;
+        }
+
+        // Drop the consumed lines in one go, only the trailing partial line is kept.
+        if (lineStart > 0)
+        {
+            this->buffer.remove(0, lineStart);
+            this->scanPosition -= lineStart;
+        }
+    }
+
+    if (!lines.isEmpty())
+        emit linesReceived(lines);
+}
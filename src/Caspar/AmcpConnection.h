@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Shared.h"
+
+#include "SpscQueue.h"
+
+#include <atomic>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QObject>
+#include <QtCore/QStringList>
+
+class QTcpSocket;
+
+// Owns the AMCP socket on a dedicated I/O thread. Commands are submitted from the GUI thread through a
+// lock-free queue and received lines are posted back in batches.
+class CASPAR_EXPORT AmcpConnection : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit AmcpConnection(QObject* parent = 0);
+
+        void submit(const QByteArray& message);
+
+        Q_SLOT void connectToHost(const QString& address, int port);
+        Q_SLOT void disconnectFromHost();
+
+        Q_SIGNAL void connected();
+        Q_SIGNAL void disconnected();
+        Q_SIGNAL void linesReceived(const QStringList&);
+
+    private:
+        QTcpSocket* socket = nullptr;
+
+        QByteArray buffer;
+        int scanPosition = 0;
+
+        SpscQueue<QByteArray> writeQueue;
+        std::atomic<bool> writeScheduled;
+
+        void resetBuffer();
+
+        Q_SLOT void readMessage();
+        Q_SLOT void writeMessages();
+        Q_SLOT void setConnected();
+};
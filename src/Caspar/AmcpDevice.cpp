@@ -1,27 +1,48 @@
 #include "AmcpDevice.h"
+#include "AmcpConnection.h"
 
+#include <QtCore/QMetaObject>
 #include <QtCore/QStringList>
 #include <QtCore/QThread>
-#include <QtCore/QTextCodec>
 #include <QtCore/QTimer>
 
-#include <QtNetwork/QTcpSocket>
+Q_LOGGING_CATEGORY(lcAmcp, "casparcg.amcp")
+
+// How long an expired command stays queued to absorb a late reply before the reply is assumed lost.
+static const int EXPIRED_GRACE_PERIOD = 10000;
 
 AmcpDevice::AmcpDevice(const QString& address, int port, QObject* parent)
     : QObject(parent), address(address), port(port)
 {
-    this->socket = new QTcpSocket(this);
+    this->timeoutTimer.setInterval(250);
+    QObject::connect(&this->timeoutTimer, SIGNAL(timeout()), this, SLOT(checkTimeouts()));
+}
 
-    this->decoder = new QTextDecoder(QTextCodec::codecForName("UTF-8"));
+AmcpDevice::~AmcpDevice()
+{
+    if (this->thread == nullptr)
+        return;
 
-    QObject::connect(this->socket, SIGNAL(readyRead()), this, SLOT(readMessage()));
-    QObject::connect(this->socket, SIGNAL(connected()), this, SLOT(setConnected()));
-    QObject::connect(this->socket, SIGNAL(disconnected()), this, SLOT(setDisconnected()));
+    this->thread->quit();
+    this->thread->wait();
 }
 
-AmcpDevice::~AmcpDevice()
+void AmcpDevice::createConnection()
 {
-    delete this->decoder;
+    // The socket lives on its own thread so that a busy GUI event loop never delays commands reaching the server.
+    // It is created on the first connect, devices that never connect (i.e. device groups) do not need one.
+    this->thread = new QThread(this);
+    this->thread->setObjectName(QString("AMCP %1:%2").arg(this->address).arg(this->port));
+
+    this->connection = new AmcpConnection();
+    this->connection->moveToThread(this->thread);
+
+    QObject::connect(this->thread, SIGNAL(finished()), this->connection, SLOT(deleteLater()));
+    QObject::connect(this->connection, SIGNAL(linesReceived(const QStringList&)), this, SLOT(readMessage(const QStringList&)));
+    QObject::connect(this->connection, SIGNAL(connected()), this, SLOT(setConnected()));
+    QObject::connect(this->connection, SIGNAL(disconnected()), this, SLOT(setDisconnected()));
+
+    this->thread->start();
 }
 
 void AmcpDevice::connectDevice()
@@ -29,16 +50,21 @@ void AmcpDevice::connectDevice()
     if (this->connected)
         return;
 
-    this->socket->connectToHost(this->address, this->port);
+    if (this->connection == nullptr)
+        createConnection();
+
+    QMetaObject::invokeMethod(this->connection, "connectToHost", Qt::QueuedConnection,
+                              Q_ARG(QString, this->address), Q_ARG(int, this->port));
 
     QTimer::singleShot(5000, this, SLOT(connectDevice()));
 }
 
 void AmcpDevice::disconnectDevice()
 {
-    this->socket->blockSignals(true);
-    this->socket->disconnectFromHost();
-    this->socket->blockSignals(false);
+    if (this->connection != nullptr)
+        QMetaObject::invokeMethod(this->connection, "disconnectFromHost", Qt::QueuedConnection);
+
+    abortPendingCommands();
 
     this->connected = false;
     this->command = AmcpDeviceCommand::CONNECTIONSTATE;
@@ -56,6 +82,8 @@ void AmcpDevice::setConnected()
 
 void AmcpDevice::setDisconnected()
 {
+    abortPendingCommands();
+
     this->connected = false;
     this->command = AmcpDeviceCommand::CONNECTIONSTATE;
 
@@ -84,34 +112,283 @@ const QString& AmcpDevice::getAddress() const
     return this->address;
 }
 
-void AmcpDevice::writeMessage(const QString& message)
+int AmcpDevice::getPendingCommandCount() const
+{
+    return this->pendingCommands.count();
+}
+
+void AmcpDevice::beginBatch()
+{
+    this->batchDepth++;
+}
+
+void AmcpDevice::endBatch()
 {
-    if (this->connected && !this->disableCommands)
+    if (this->batchDepth == 0 || --this->batchDepth > 0)
+        return;
+
+    flushBatch();
+}
+
+void AmcpDevice::beginBatch(int token, const QStringList& channels, bool deferMixer)
+{
+    AmcpDeviceBatch batch;
+    batch.channels = channels;
+    batch.deferMixer = deferMixer;
+
+    this->batches.insert(token, batch);
+}
+
+void AmcpDevice::endBatch(int token)
+{
+    if (!this->batches.contains(token))
+        return;
+
+    const AmcpDeviceBatch batch = this->batches.take(token);
+
+    // Held commands enter the pending queue only now, replies are correlated in the order the commands are sent.
+    foreach (const AmcpDevicePendingCommand& command, batch.commands)
+        enqueueMessage(command.message, command.callback, command.timeout);
+
+    // Apply every deferred transform of the batch in the same frame.
+    foreach (const QString& channel, batch.deferredChannels)
+        enqueueMessage(QString("MIXER %1 COMMIT").arg(channel), AmcpDeviceCallback(), 0);
+
+    flushBatch();
+}
+
+void AmcpDevice::writeMessage(const QString& message, const AmcpDeviceCallback& callback, int timeout)
+{
+    if (!this->connected || this->disableCommands)
+    {
+        if (callback)
+            callback(0, QList<QString>());
+
+        return;
+    }
+
+    QString line = message.trimmed();
+
+    // Format: COMMAND 1-10 ..., commands without a channel are never held.
+    QString channel = line.section(' ', 1, 1, QString::SectionSkipEmpty).section('-', 0, 0);
+    if (!this->batches.isEmpty() && !channel.isEmpty() && channel.at(0).isDigit())
     {
-        this->socket->write(QString("%1\r\n").arg(message.trimmed()).toUtf8());
-        this->socket->flush();
+        foreach (int token, this->batches.keys())
+        {
+            AmcpDeviceBatch& batch = this->batches[token];
+            if (!batch.channels.contains(channel))
+                continue;
+
+            AmcpDevicePendingCommand command;
+            command.command = AmcpDeviceCommand::NONE;
+            command.message = (batch.deferMixer) ? deferMixerMessage(line, batch.deferredChannels) : line;
+            command.callback = callback;
+            command.timeout = timeout;
+            command.expired = false;
+            batch.commands.append(command);
+
+            return;
+        }
+    }
+
+    enqueueMessage(line, callback, timeout);
+}
+
+void AmcpDevice::enqueueMessage(const QString& message, const AmcpDeviceCallback& callback, int timeout)
+{
+    this->batchBuffer.append(message.toUtf8()).append("\r\n");
 
-        qDebug("Sent message to %s:%d: %s\\r\\n", qPrintable(this->address), this->port, qPrintable(message.trimmed()));
+    AmcpDevicePendingCommand pendingCommand;
+    pendingCommand.command = translateMessage(message);
+    pendingCommand.message = message;
+    pendingCommand.callback = callback;
+    pendingCommand.timeout = timeout;
+    pendingCommand.expired = false;
+    pendingCommand.timer.start();
+
+    this->pendingCommands.enqueue(pendingCommand);
+
+    if (timeout > 0 && !this->timeoutTimer.isActive())
+        this->timeoutTimer.start();
+
+    // Outside of an explicit batch, everything written during this event loop turn goes out in one write.
+    if (this->batchDepth == 0 && !this->flushScheduled)
+    {
+        this->flushScheduled = true;
+        QMetaObject::invokeMethod(this, "flushBatch", Qt::QueuedConnection);
     }
+
+    qCDebug(lcAmcp, "Sent message to %s:%d: %s\\r\\n", qPrintable(this->address), this->port, qPrintable(message));
+}
+
+void AmcpDevice::flushBatch()
+{
+    this->flushScheduled = false;
+
+    if (this->batchDepth > 0 || this->batchBuffer.isEmpty() || this->connection == nullptr)
+        return;
+
+    this->connection->submit(this->batchBuffer);
+    this->batchBuffer.clear();
+}
+
+QString AmcpDevice::deferMixerMessage(const QString& message, QStringList& deferredChannels)
+{
+    // Format: MIXER 1-10 OPACITY 0.5 [DURATION TWEEN] [DEFER]
+    QStringList tokens = message.split(" ", QString::SkipEmptyParts);
+    if (tokens.count() < 3 || tokens.at(0).toUpper() != "MIXER")
+        return message;
+
+    static const QStringList deferrable = QStringList() << "KEYER" << "OPACITY" << "BRIGHTNESS" << "SATURATION" << "CONTRAST"
+                                                        << "LEVELS" << "FILL" << "CLIP" << "ANCHOR" << "CROP" << "PERSPECTIVE"
+                                                        << "ROTATION" << "VOLUME" << "GRID";
+    if (!deferrable.contains(tokens.at(2).toUpper()))
+        return message;
+
+    QString channel = tokens.at(1).section('-', 0, 0);
+    if (!deferredChannels.contains(channel))
+        deferredChannels.append(channel);
+
+    if (tokens.last().toUpper() == "DEFER")
+        return message;
+
+    return QString("%1 DEFER").arg(message);
 }
 
-void AmcpDevice::readMessage()
+void AmcpDevice::checkTimeouts()
 {
-    while (this->socket->bytesAvailable())
+    while (!this->pendingCommands.isEmpty() && this->pendingCommands.head().expired &&
+           this->pendingCommands.head().timer.hasExpired(this->pendingCommands.head().timeout + EXPIRED_GRACE_PERIOD))
     {
-        this->fragments += this->decoder->toUnicode(this->socket->readAll());
+        qWarning("No reply from %s:%d, dropping expired command: %s", qPrintable(this->address), this->port, qPrintable(this->pendingCommands.head().message));
 
-        int position;
-        while ((position = this->fragments.indexOf("\r\n")) != -1)
+        this->pendingCommands.dequeue();
+    }
+
+    bool waiting = false;
+    for (int i = 0; i < this->pendingCommands.count(); i++)
+    {
+        AmcpDevicePendingCommand& pendingCommand = this->pendingCommands[i];
+        if (pendingCommand.expired)
         {
-            QString line = this->fragments.left(position);
-            this->fragments.remove(0, position + 2);
+            waiting = true; // Until the grace period has passed.
+            continue;
+        }
 
-            parseLine(line);
+        if (pendingCommand.timeout <= 0)
+            continue;
+
+        if (!pendingCommand.timer.hasExpired(pendingCommand.timeout))
+        {
+            waiting = true;
+            continue;
         }
+
+        qWarning("Command to %s:%d timed out after %d msec: %s", qPrintable(this->address), this->port, pendingCommand.timeout, qPrintable(pendingCommand.message));
+
+        // Keep the entry queued so that a late reply is still consumed by it and does not shift the correlation.
+        pendingCommand.expired = true;
+
+        AmcpDeviceCallback callback = pendingCommand.callback;
+        if (callback)
+            callback(0, QList<QString>());
+    }
+
+    if (!waiting)
+        this->timeoutTimer.stop();
+}
+
+void AmcpDevice::abortPendingCommands()
+{
+    QList<AmcpDevicePendingCommand> pendingCommands = this->pendingCommands;
+    if (this->hasCurrentCommand)
+        pendingCommands.prepend(this->currentCommand);
+
+    this->pendingCommands.clear();
+    this->hasCurrentCommand = false;
+    this->timeoutTimer.stop();
+
+    // Neither unsent commands nor a partial reply from the lost connection must leak into the next one.
+    this->batchBuffer.clear();
+    resetDevice();
+
+    foreach (int token, this->batches.keys())
+    {
+        AmcpDeviceBatch& batch = this->batches[token];
+        pendingCommands.append(batch.commands);
+
+        batch.commands.clear();
+        batch.deferredChannels.clear();
+    }
+
+    foreach (const AmcpDevicePendingCommand& pendingCommand, pendingCommands)
+    {
+        if (pendingCommand.callback && !pendingCommand.expired)
+            pendingCommand.callback(0, QList<QString>());
     }
 }
 
+void AmcpDevice::takePendingCommand(AmcpDeviceCommand replyCommand)
+{
+    if (this->pendingCommands.isEmpty())
+        return;
+
+    // Replies that name their command must match the oldest in-flight command. If not, the replies of the
+    // commands before the matching one were lost (e.g. the server restarted without a disconnect), they are
+    // failed instead of shifting the correlation for the rest of the connection.
+    if (replyCommand != AmcpDeviceCommand::NONE && replyCommand != AmcpDeviceCommand::ERROR &&
+        this->pendingCommands.head().command != replyCommand)
+    {
+        int index = -1;
+        for (int i = 1; i < this->pendingCommands.count(); i++)
+        {
+            if (this->pendingCommands.at(i).command == replyCommand)
+            {
+                index = i;
+                break;
+            }
+        }
+
+        if (index < 0)
+        {
+            qWarning("Unexpected reply from %s:%d, expected a reply to: %s", qPrintable(this->address), this->port, qPrintable(this->pendingCommands.head().message));
+            return;
+        }
+
+        for (int i = 0; i < index; i++)
+        {
+            AmcpDevicePendingCommand pendingCommand = this->pendingCommands.dequeue();
+
+            qWarning("No reply from %s:%d, dropping command: %s", qPrintable(this->address), this->port, qPrintable(pendingCommand.message));
+
+            if (pendingCommand.callback && !pendingCommand.expired)
+                pendingCommand.callback(0, QList<QString>());
+        }
+    }
+
+    this->currentCommand = this->pendingCommands.dequeue();
+    this->hasCurrentCommand = true;
+}
+
+void AmcpDevice::completeCommand()
+{
+    if (this->hasCurrentCommand)
+    {
+        this->hasCurrentCommand = false;
+
+        if (this->currentCommand.callback && !this->currentCommand.expired)
+            this->currentCommand.callback(this->code, this->response);
+    }
+
+    sendNotification();
+}
+
+void AmcpDevice::readMessage(const QStringList& lines)
+{
+    foreach (const QString& line, lines)
+        parseLine(line);
+}
+
 AmcpDevice::AmcpDeviceCommand AmcpDevice::translateCommand(const QString& command)
 {
     if (command == "LOAD") return AmcpDeviceCommand::LOAD;
@@ -142,6 +419,38 @@ AmcpDevice::AmcpDeviceCommand AmcpDevice::translateCommand(const QString& comman
     return AmcpDeviceCommand::NONE;
 }
 
+AmcpDevice::AmcpDeviceCommand AmcpDevice::translateMessage(const QString& message)
+{
+    QStringList tokens = message.trimmed().split(" ", QString::SkipEmptyParts);
+    if (tokens.isEmpty())
+        return AmcpDeviceCommand::NONE;
+
+    if (tokens.count() > 1)
+    {
+        AmcpDeviceCommand command = translateCommand(QString("%1 %2").arg(tokens.at(0).toUpper()).arg(tokens.at(1).toUpper()));
+        if (command != AmcpDeviceCommand::NONE)
+            return command;
+    }
+
+    return translateCommand(tokens.at(0).toUpper());
+}
+
+AmcpDevice::AmcpDeviceCommand AmcpDevice::translateReply(const QStringList& tokens)
+{
+    // Format: <code> <command> [<subcommand>] OK|FAILED|...
+    if (tokens.count() < 3)
+        return AmcpDeviceCommand::NONE;
+
+    if (tokens.count() > 3)
+    {
+        AmcpDeviceCommand command = translateCommand(QString("%1 %2").arg(tokens.at(1)).arg(tokens.at(2)));
+        if (command != AmcpDeviceCommand::NONE)
+            return command;
+    }
+
+    return translateCommand(tokens.at(1));
+}
+
 void AmcpDevice::parseLine(const QString& line)
 {
     switch (this->state)
@@ -171,6 +480,10 @@ void AmcpDevice::parseHeader(const QString& line)
     QStringList tokens = line.split(" ");
 
     this->code = tokens.at(0).toInt();
+
+    // Replies arrive in the order the commands were sent, so the oldest in-flight command owns this reply.
+    takePendingCommand(translateReply(tokens));
+
     switch (this->code)
     {
         case 200: // The command has been executed and several lines of data are being returned.
@@ -185,9 +498,16 @@ void AmcpDevice::parseHeader(const QString& line)
             return;
     }
 
-    this->command = translateCommand(tokens.at(1));
-    if (tokens.count() > 3)
-        this->command = translateCommand(QString("%1 %2").arg(tokens.at(1)).arg(tokens.at(2)));
+    if (this->hasCurrentCommand && this->code < 400)
+    {
+        this->command = this->currentCommand.command;
+    }
+    else if (tokens.count() > 1)
+    {
+        this->command = translateCommand(tokens.at(1));
+        if (tokens.count() > 3)
+            this->command = translateCommand(QString("%1 %2").arg(tokens.at(1)).arg(tokens.at(2)));
+    }
 
     this->response.append(line);
 }
@@ -196,7 +516,7 @@ void AmcpDevice::parseOneline(const QString& line)
 {
     AmcpDevice::response.append(line);
 
-    sendNotification();
+    completeCommand();
 }
 
 void AmcpDevice::parseTwoline(const QString& line)
@@ -204,13 +524,13 @@ void AmcpDevice::parseTwoline(const QString& line)
     AmcpDevice::response.append(line);
 
     if (AmcpDevice::response.count() == 2)
-        sendNotification();
+        completeCommand();
 }
 
 void AmcpDevice::parseMultiline(const QString& line)
 {
     if (line.length() == 0)
-        sendNotification();
+        completeCommand();
     else
         AmcpDevice::response.append(line);
 }
@@ -2,11 +2,29 @@
 
 #include "Shared.h"
 
+#include <functional>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QList>
+#include <QtCore/QMap>
+#include <QtCore/QLoggingCategory>
 #include <QtCore/QObject>
+#include <QtCore/QQueue>
+#include <QtCore/QStringList>
+#include <QtCore/QTimer>
 
 class QObject;
-class QTcpSocket;
-class QTextDecoder;
+class QThread;
+
+class AmcpConnection;
+
+// AMCP wire traffic, can be silenced with the rule "casparcg.amcp.debug=false".
+Q_DECLARE_LOGGING_CATEGORY(lcAmcp)
+
+// Invoked once per command with the reply code and lines (header first). A code of 0 means that no reply
+// was received, i.e. the command was never sent, timed out or the connection was lost.
+typedef std::function<void(int code, const QList<QString>& response)> AmcpDeviceCallback;
 
 class CASPAR_EXPORT AmcpDevice : public QObject
 {
@@ -23,6 +41,17 @@ class CASPAR_EXPORT AmcpDevice : public QObject
         bool isConnected() const;
         int getPort() const;
         const QString& getAddress() const;
+        int getPendingCommandCount() const;
+
+        // Commands written between beginBatch() and endBatch() go out in a single write.
+        void beginBatch();
+        void endBatch();
+
+        // Commands for one of the channels are held from beginBatch() until endBatch() with the same token, other
+        // commands are not affected. With deferMixer set, deferrable MIXER commands get DEFER appended and a
+        // MIXER COMMIT is sent per channel at the end.
+        void beginBatch(int token, const QStringList& channels, bool deferMixer);
+        void endBatch(int token);
 
         Q_SLOT void connectDevice();
 
@@ -57,7 +86,6 @@ class CASPAR_EXPORT AmcpDevice : public QObject
             THUMBNAILRETRIEVE
         };
 
-        QTcpSocket* socket = nullptr;
         AmcpDeviceCommand command = AmcpDeviceCommand::NONE;
 
         QList<QString> response;
@@ -65,7 +93,8 @@ class CASPAR_EXPORT AmcpDevice : public QObject
         virtual void sendNotification() = 0;
 
         void resetDevice();
-        void writeMessage(const QString& message);
+
+        virtual void writeMessage(const QString& message, const AmcpDeviceCallback& callback = AmcpDeviceCallback(), int timeout = 0);
 
     private:
         enum class AmcpDeviceParserState
@@ -76,6 +105,24 @@ class CASPAR_EXPORT AmcpDevice : public QObject
             ExpectingMultiline
         };
 
+        struct AmcpDevicePendingCommand
+        {
+            AmcpDeviceCommand command;
+            QString message;
+            AmcpDeviceCallback callback;
+            QElapsedTimer timer;
+            int timeout;
+            bool expired;
+        };
+
+        struct AmcpDeviceBatch
+        {
+            QStringList channels;
+            bool deferMixer;
+            QStringList deferredChannels;
+            QList<AmcpDevicePendingCommand> commands;
+        };
+
         QString address;
 
         int port;
@@ -84,21 +131,43 @@ class CASPAR_EXPORT AmcpDevice : public QObject
         bool connected = false;
         bool disableCommands = false;
 
-        QString fragments;
+        QThread* thread = nullptr;
+        AmcpConnection* connection = nullptr;
 
-        QTextDecoder* decoder = nullptr;
+        int batchDepth = 0;
+        bool flushScheduled = false;
+        QByteArray batchBuffer;
+        QMap<int, AmcpDeviceBatch> batches;
 
         AmcpDeviceParserState state = AmcpDeviceParserState::ExpectingHeader;
 
+        QQueue<AmcpDevicePendingCommand> pendingCommands;
+        AmcpDevicePendingCommand currentCommand;
+        bool hasCurrentCommand = false;
+        QTimer timeoutTimer;
+
+        void createConnection();
+
         void parseLine(const QString& line);
         void parseHeader(const QString& line);
         void parseOneline(const QString& line);
         void parseTwoline(const QString& line);
         void parseMultiline(const QString& line);
 
+        void enqueueMessage(const QString& message, const AmcpDeviceCallback& callback, int timeout);
+        QString deferMixerMessage(const QString& message, QStringList& deferredChannels);
+
+        void takePendingCommand(AmcpDeviceCommand replyCommand);
+        void completeCommand();
+        void abortPendingCommands();
+
         AmcpDeviceCommand translateCommand(const QString& command);
+        AmcpDeviceCommand translateMessage(const QString& message);
+        AmcpDeviceCommand translateReply(const QStringList& tokens);
 
-        Q_SLOT void readMessage();
+        Q_SLOT void readMessage(const QStringList& lines);
+        Q_SLOT void flushBatch();
+        Q_SLOT void checkTimeouts();
         Q_SLOT void setConnected();
         Q_SLOT void setDisconnected();
 };
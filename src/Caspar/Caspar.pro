@@ -10,20 +10,24 @@ DEFINES += CASPAR_LIBRARY
 
 HEADERS += \
     CasparDevice.h \
+    CasparDeviceGroup.h \
     Shared.h \
     Models/CasparThumbnail.h \
     Models/CasparTemplate.h \
     Models/CasparMedia.h \
     Models/CasparData.h \
-    AmcpDevice.h
+    AmcpDevice.h \
+    AmcpConnection.h
 	
 SOURCES += \
     CasparDevice.cpp \
+    CasparDeviceGroup.cpp \
     Models/CasparThumbnail.cpp \
     Models/CasparTemplate.cpp \
     Models/CasparMedia.cpp \
     Models/CasparData.cpp \
-    AmcpDevice.cpp
+    AmcpDevice.cpp \
+    AmcpConnection.cpp
 
 DEPENDPATH += $$OUT_PWD/../Common $$PWD/../Common
 INCLUDEPATH += $$OUT_PWD/../Common $$PWD/../Common
@@ -4,9 +4,11 @@
 
 #include "../Core/DatabaseManager.h"
 
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QHash>
 #include <QtCore/QStringList>
 
-#include <QtNetwork/QHostInfo>
+#include <QtNetwork/QHostAddress>
 
 CasparDevice::CasparDevice(const QString& address, int port, QObject* parent)
     : AmcpDevice(address, port, parent)
@@ -22,15 +24,13 @@ const QString CasparDevice::resolveIpAddress() const
     if (!address.isNull())
         return getAddress(); // The ip address is valid.
 
-    // We don't have a valid ip address. Try to resolve using dns lookup.
-    QHostInfo hostInfo = QHostInfo::fromName(AmcpDevice::getAddress());
-    if (hostInfo.error() != QHostInfo::NoError)
-        return "";
-
-    if (hostInfo.addresses().isEmpty())
-        return "";
+    // We don't have a valid ip address, use the last dns lookup.
+    return this->resolvedAddress;
+}
 
-    return hostInfo.addresses().at(0).toString();
+void CasparDevice::setResolvedAddress(const QString& address)
+{
+    this->resolvedAddress = address;
 }
 
 void CasparDevice::refreshData()
@@ -78,11 +78,49 @@ void CasparDevice::retrieveThumbnail(const QString& name)
     writeMessage(QString("THUMBNAIL RETRIEVE \"%1\"").arg(name));
 }
 
+void CasparDevice::retrieveThumbnail(const QString& name, const AmcpDeviceCallback& callback, int timeout)
+{
+    writeMessage(QString("THUMBNAIL RETRIEVE \"%1\"").arg(name), callback, timeout);
+}
+
+void CasparDevice::resetListingHashes()
+{
+    this->listingHashes.clear();
+}
+
+bool CasparDevice::isListingUnchanged()
+{
+    // Hash the raw reply, an unchanged listing is neither parsed nor diffed against the library.
+    QCryptographicHash digest(QCryptographicHash::Sha1);
+    foreach (const QString& line, AmcpDevice::response)
+    {
+        digest.addData(line.toUtf8());
+        digest.addData("\n", 1);
+    }
+
+    const QByteArray hash = digest.result();
+
+    if (this->listingHashes.contains(AmcpDevice::command) && this->listingHashes.value(AmcpDevice::command) == hash)
+    {
+        qDebug("Listing from %s:%d unchanged: %s", qPrintable(AmcpDevice::getAddress()), AmcpDevice::getPort(), qPrintable(AmcpDevice::response.at(0).trimmed()));
+        return true;
+    }
+
+    this->listingHashes.insert(AmcpDevice::command, hash);
+
+    return false;
+}
+
 void CasparDevice::sendCommand(const QString& command)
 {
     writeMessage(QString("%1").arg(command));
 }
 
+void CasparDevice::sendCommand(const QString& command, const AmcpDeviceCallback& callback, int timeout)
+{
+    writeMessage(QString("%1").arg(command), callback, timeout);
+}
+
 void CasparDevice::clearChannel(int channel)
 {
     writeMessage(QString("CLEAR %1").arg(channel));
@@ -621,10 +659,39 @@ void CasparDevice::setAnchor(int channel, int videolayer, float positionX, float
                  .arg((defer == true) ? "DEFER" : ""));
 }
 
+QString CasparDevice::parseName(const QString& line, int& position)
+{
+    // Listing lines start with the quoted name, the fields follow after the closing quote.
+    int end = line.indexOf("\" ");
+    QString name = (end == -1) ? line : line.left(end);
+    position = (end == -1) ? line.length() : end + 2;
+
+    name.replace("\\", "/");
+    if (name.startsWith("\""))
+        name.remove(0, 1);
+
+    if (name.endsWith("\""))
+        name.chop(1);
+
+    return name;
+}
+
+QStringRef CasparDevice::nextField(const QString& line, int& position)
+{
+    while (position < line.length() && line.at(position) == ' ')
+        position++;
+
+    int start = position;
+    while (position < line.length() && line.at(position) != ' ')
+        position++;
+
+    return line.midRef(start, position - start);
+}
+
 void CasparDevice::sendNotification()
 {
     if (AmcpDevice::response.count() > 0)
-        qDebug("Received message from %s:%d: %s\\r\\n", qPrintable(AmcpDevice::getAddress()), AmcpDevice::getPort(), qPrintable(AmcpDevice::response.at(0).trimmed()));
+        qCDebug(lcAmcp, "Received message from %s:%d: %s\\r\\n", qPrintable(AmcpDevice::getAddress()), AmcpDevice::getPort(), qPrintable(AmcpDevice::response.at(0).trimmed()));
 
     switch (AmcpDevice::command)
     {
@@ -632,35 +699,36 @@ void CasparDevice::sendNotification()
         {
             emit responseChanged(AmcpDevice::response.at(0), *this);
 
-            AmcpDevice::response.removeFirst(); // First post is the header, 200 CLS OK.
+            if (isListingUnchanged())
+                break;
 
+            // First post is the header, 200 CLS OK.
             QList<CasparMedia> items;
-            foreach (QString response, AmcpDevice::response)
+            items.reserve(AmcpDevice::response.count() - 1);
+            for (int i = 1; i < AmcpDevice::response.count(); i++)
             {
-                QString name = response.split("\" ").at(0);
-                name.replace("\\", "/");
-                if (name.startsWith("\""))
-                    name.remove(0, 1);
-
-                if (name.endsWith("\""))
-                    name.remove(name.length() - 1, 1);
-
-                QString type = response.split("\" ").at(1).trimmed().split(" ").at(0);
+                // Format:
+                // "AMB"  MOVIE  6445960 20121101160514 643 1/60
+                // "CG1080I50"  MOVIE  6159792 20121101150514 264 1/25
+                // "GO1080P25"  MOVIE  16694084 20121101150514 445 1/25
+                // "WIPE"  MOVIE  1268784 20121101150514 31 1/25
+                // "HOOLOOVOO"  MOVIE  1111111 22222222222222 333 100/2997
+                const QString& line = AmcpDevice::response.at(i);
+
+                int position;
+                QString name = parseName(line, position);
+                QString type = nextField(line, position).toString();
+                nextField(line, position); // Size.
+                nextField(line, position); // Timestamp.
+                QStringRef totalFrames = nextField(line, position);
+                QStringRef timebase = nextField(line, position);
 
                 QString timecode;
-                if (response.split("\" ").at(1).trimmed().split(" ").count() > 5)
+                int separator = timebase.indexOf('/');
+                if (separator != -1)
                 {
-                    // Format:
-                    // "AMB"  MOVIE  6445960 20121101160514 643 1/60
-                    // "CG1080I50"  MOVIE  6159792 20121101150514 264 1/25
-                    // "GO1080P25"  MOVIE  16694084 20121101150514 445 1/25
-                    // "WIPE"  MOVIE  1268784 20121101150514 31 1/25
-                    // "HOOLOOVOO"  MOVIE  1111111 22222222222222 333 100/2997
-                    QString totalFrames = response.split("\" ").at(1).trimmed().split(" ").at(4);
-                    QStringList timebase = response.split("\" ").at(1).trimmed().split(" ").at(5).split("/");
-
                     int frames = totalFrames.toInt();
-                    double fps = timebase.at(1).toDouble() / timebase.at(0).toDouble();
+                    double fps = timebase.mid(separator + 1).toDouble() / timebase.left(separator).toDouble();
 
                     double time = frames * (1.0 / fps);
                     timecode = Timecode::fromTime(time, fps, false);
@@ -677,20 +745,16 @@ void CasparDevice::sendNotification()
         {
             emit responseChanged(AmcpDevice::response.at(0), *this);
 
-            AmcpDevice::response.removeFirst(); // First post is the header, 200 TLS OK.
+            if (isListingUnchanged())
+                break;
 
+            // First post is the header, 200 TLS OK.
             QList<CasparTemplate> items;
-            foreach (QString response, AmcpDevice::response)
+            items.reserve(AmcpDevice::response.count() - 1);
+            for (int i = 1; i < AmcpDevice::response.count(); i++)
             {
-                QString name = response.split("\" ").at(0);
-                name.replace("\\", "/");
-                if (name.startsWith("\""))
-                    name.remove(0, 1);
-
-                if (name.endsWith("\""))
-                    name.remove(name.length() - 1, 1);
-
-                items.push_back(CasparTemplate(name));
+                int position;
+                items.push_back(CasparTemplate(parseName(AmcpDevice::response.at(i), position)));
             }
 
             emit templateChanged(items, *this);
@@ -716,20 +780,16 @@ void CasparDevice::sendNotification()
         {
             emit responseChanged(AmcpDevice::response.at(0), *this);
 
-            AmcpDevice::response.removeFirst(); // First post is the header, 200 DATA LIST OK.
+            if (isListingUnchanged())
+                break;
 
+            // First post is the header, 200 DATA LIST OK.
             QList<CasparData> items;
-            foreach (QString response, AmcpDevice::response)
+            items.reserve(AmcpDevice::response.count() - 1);
+            for (int i = 1; i < AmcpDevice::response.count(); i++)
             {
-                QString name = response.split("\" ").at(0);
-                name.replace("\\", "/");
-                if (name.startsWith("\""))
-                    name.remove(0, 1);
-
-                if (name.endsWith("\""))
-                    name.remove(name.length() - 1, 1);
-
-                items.push_back(CasparData(name));
+                int position;
+                items.push_back(CasparData(parseName(AmcpDevice::response.at(i), position)));
             }
 
             emit dataChanged(items, *this);
@@ -740,21 +800,20 @@ void CasparDevice::sendNotification()
         {
             emit responseChanged(AmcpDevice::response.at(0), *this);
 
-            AmcpDevice::response.removeFirst(); // First post is the header, 200 THUMBNAIL LIST OK.
+            if (isListingUnchanged())
+                break;
 
+            // First post is the header, 200 THUMBNAIL LIST OK.
             QList<CasparThumbnail> items;
-            foreach (QString response, AmcpDevice::response)
+            items.reserve(AmcpDevice::response.count() - 1);
+            for (int i = 1; i < AmcpDevice::response.count(); i++)
             {
-                QString name = response.split("\" ").at(0);
-                name.replace("\\", "/");
-                if (name.startsWith("\""))
-                    name.remove(0, 1);
+                const QString& line = AmcpDevice::response.at(i);
 
-                if (name.endsWith("\""))
-                    name.remove(name.length() - 1, 1);
-
-                QString timestamp = response.split("\" ").at(1).trimmed().split(" ").at(0);
-                QString size = response.split("\" ").at(1).trimmed().split(" ").at(1);
+                int position;
+                QString name = parseName(line, position);
+                QString timestamp = nextField(line, position).toString();
+                QString size = nextField(line, position).toString();
 
                 items.push_back(CasparThumbnail(name, timestamp, size));
             }
@@ -781,6 +840,9 @@ void CasparDevice::sendNotification()
         }
         case AmcpDevice::AmcpDeviceCommand::CONNECTIONSTATE:
         {
+            if (!AmcpDevice::isConnected())
+                resetListingHashes(); // Resynchronize the library after a reconnect.
+
             emit connectionStateChanged(*this);
 
             break;
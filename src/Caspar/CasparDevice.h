@@ -8,7 +8,10 @@
 #include "Models/CasparTemplate.h"
 #include "Models/CasparThumbnail.h"
 
+#include <QtCore/QMap>
+
 class QObject;
+class QStringRef;
 
 class CASPAR_EXPORT CasparDevice : public AmcpDevice
 {
@@ -17,7 +20,9 @@ class CASPAR_EXPORT CasparDevice : public AmcpDevice
     public:
         explicit CasparDevice(const QString& address, int port = 5250, QObject* parent = 0);
 
+        // Never blocks, host names return the address last resolved by the owner or an empty string.
         const QString resolveIpAddress() const;
+        void setResolvedAddress(const QString& address);
 
         void refreshData();
         void refreshMedia();
@@ -30,8 +35,14 @@ class CASPAR_EXPORT CasparDevice : public AmcpDevice
         void refreshTemplateHostVersion();
 
         void retrieveThumbnail(const QString& name);
+        void retrieveThumbnail(const QString& name, const AmcpDeviceCallback& callback, int timeout = 0);
+
+        // Forget the last seen listings, the next CLS, TLS, DATA LIST and THUMBNAIL LIST replies are parsed and
+        // notified even if they did not change.
+        void resetListingHashes();
 
         void sendCommand(const QString& command);
+        void sendCommand(const QString& command, const AmcpDeviceCallback& callback, int timeout = 0);
 
         void clearChannel(int channel);
         void clearMixerChannel(int channel);
@@ -134,4 +145,13 @@ class CASPAR_EXPORT CasparDevice : public AmcpDevice
 
     protected:
         void sendNotification();
+
+    private:
+        QString resolvedAddress;
+        QMap<AmcpDevice::AmcpDeviceCommand, QByteArray> listingHashes;
+
+        bool isListingUnchanged();
+
+        static QString parseName(const QString& line, int& position);
+        static QStringRef nextField(const QString& line, int& position);
 };
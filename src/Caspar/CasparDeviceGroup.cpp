@@ -0,0 +1,37 @@
+#include "CasparDeviceGroup.h"
+
+CasparDeviceGroup::CasparDeviceGroup(QObject* parent)
+    : CasparDevice("", 0, parent)
+{
+}
+
+bool CasparDeviceGroup::isEmpty() const
+{
+    return this->devices.isEmpty();
+}
+
+const QList<QSharedPointer<CasparDevice>>& CasparDeviceGroup::getDevices() const
+{
+    return this->devices;
+}
+
+void CasparDeviceGroup::setDevices(const QList<QSharedPointer<CasparDevice>>& devices)
+{
+    this->devices = devices;
+}
+
+void CasparDeviceGroup::writeMessage(const QString& message, const AmcpDeviceCallback& callback, int timeout)
+{
+    if (this->devices.isEmpty())
+    {
+        if (callback)
+            callback(0, QList<QString>());
+
+        return;
+    }
+
+    // Only the first member reports back, the callback is invoked once per command.
+    this->devices.first()->sendCommand(message, callback, timeout);
+    for (int i = 1; i < this->devices.count(); i++)
+        this->devices.at(i)->sendCommand(message);
+}
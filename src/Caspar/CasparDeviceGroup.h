@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Shared.h"
+
+#include "CasparDevice.h"
+
+#include <QtCore/QList>
+#include <QtCore/QSharedPointer>
+
+class QObject;
+
+// Broadcasts every command to a set of devices, i.e. a primary server and its shadow servers. The command is
+// formatted once by the group and the same message is queued on each member.
+class CASPAR_EXPORT CasparDeviceGroup : public CasparDevice
+{
+    Q_OBJECT
+
+    public:
+        explicit CasparDeviceGroup(QObject* parent = 0);
+
+        bool isEmpty() const;
+        const QList<QSharedPointer<CasparDevice>>& getDevices() const;
+        void setDevices(const QList<QSharedPointer<CasparDevice>>& devices);
+
+    protected:
+        void writeMessage(const QString& message, const AmcpDeviceCallback& callback = AmcpDeviceCallback(), int timeout = 0);
+
+    private:
+        QList<QSharedPointer<CasparDevice>> devices;
+};
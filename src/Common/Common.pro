@@ -12,12 +12,16 @@ HEADERS += \
     Shared.h \
     Timecode.h \
     Xml.h \
-    Playout.h
+    Playout.h \
+    SpscQueue.h \
+    MpscQueue.h \
+    Logger.h
 	
 SOURCES += \
     Timecode.cpp \
     Xml.cpp \
-    Playout.cpp
+    Playout.cpp \
+    Logger.cpp
 
 OTHER_FILES += \
     Version.h.in
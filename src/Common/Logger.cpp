@@ -0,0 +1,164 @@
+#include "Logger.h"
+
+#include <cstdio>
+
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
+#include <QtCore/QMutexLocker>
+
+Q_GLOBAL_STATIC(Logger, logger)
+
+// Set while the current thread drains the queue, lines logged from within drain() are only queued.
+static thread_local bool draining = false;
+
+Logger::Logger()
+    : queue(16384), droppedLines(0), running(false), stopped(false)
+{
+    setObjectName("Logger");
+}
+
+Logger& Logger::getInstance()
+{
+    return *logger();
+}
+
+void Logger::initialize(const QString& path, qint64 maxFileSize)
+{
+    this->path = path;
+    this->maxFileSize = maxFileSize;
+
+    QDir directory(path);
+    if (!directory.exists())
+        directory.mkpath(".");
+
+    this->running.store(true);
+    start(QThread::LowPriority);
+}
+
+void Logger::uninitialize()
+{
+    if (QThread::currentThread() == this)
+    {
+        // A fatal message from the logger thread, it can not wait for itself.
+        this->running.store(false);
+        this->stopped.store(true);
+        drain();
+
+        return;
+    }
+
+    if (this->running.exchange(false))
+    {
+        this->waitCondition.wakeOne();
+        wait();
+    }
+
+    // From now on lines are written by the thread that logs them.
+    this->stopped.store(true);
+    drain();
+
+    this->file.close();
+}
+
+void Logger::write(QtMsgType type, const QString& line)
+{
+    // Lines logged before initialize() wait in the queue. When the queue is full the line is counted and dropped
+    // instead of stalling the caller.
+    if (!this->queue.push(line))
+        this->droppedLines.fetch_add(1, std::memory_order_relaxed);
+
+    if (this->stopped.load() && !draining)
+        drain();
+    else if (type != QtDebugMsg)
+        this->waitCondition.wakeOne();
+}
+
+void Logger::run()
+{
+    while (this->running.load())
+    {
+        drain();
+
+        QMutexLocker locker(&this->waitMutex);
+        this->waitCondition.wait(&this->waitMutex, 100);
+    }
+
+    drain();
+}
+
+void Logger::drain()
+{
+    if (draining)
+        return;
+
+    QMutexLocker locker(&this->drainMutex);
+    draining = true;
+
+    const QString date = QDate::currentDate().toString("yyyy-MM-dd");
+    if (date != this->fileDate || !this->file.isOpen())
+    {
+        this->fileDate = date;
+        openFile();
+    }
+
+    QString line;
+    while (this->queue.pop(line))
+    {
+        QByteArray data = line.toUtf8();
+        data.append('\n');
+
+        fputs(data.constData(), stderr);
+
+        if (this->file.isOpen())
+        {
+            this->file.write(data);
+
+            if (this->maxFileSize > 0 && this->file.size() > this->maxFileSize)
+                rotateFile();
+        }
+    }
+
+    int droppedLines = this->droppedLines.exchange(0, std::memory_order_relaxed);
+    if (droppedLines > 0)
+    {
+        QByteArray data = QString("[%1] [W] Dropped %2 log lines\n").arg(QDateTime::currentDateTime().toString("yyyy-MM-dd hh:mm:ss.zzz"))
+                                                                      .arg(droppedLines).toUtf8();
+        fputs(data.constData(), stderr);
+
+        if (this->file.isOpen())
+            this->file.write(data);
+    }
+
+    fflush(stderr);
+
+    if (this->file.isOpen())
+        this->file.flush();
+
+    draining = false;
+}
+
+void Logger::openFile()
+{
+    this->file.close();
+
+    if (this->path.isEmpty())
+        return; // Not initialized yet.
+
+    this->file.setFileName(QString("%1/Client_%2.log").arg(this->path).arg(this->fileDate));
+    if (!this->file.open(QIODevice::WriteOnly | QIODevice::Append))
+        fprintf(stderr, "Unable to open log file %s\n", qPrintable(this->file.fileName()));
+}
+
+void Logger::rotateFile()
+{
+    this->file.close();
+
+    // Keep the full file as Client_<date>.<n>.log and continue in a new one.
+    int index = 1;
+    while (QFile::exists(QString("%1/Client_%2.%3.log").arg(this->path).arg(this->fileDate).arg(index)))
+        index++;
+
+    QFile::rename(this->file.fileName(), QString("%1/Client_%2.%3.log").arg(this->path).arg(this->fileDate).arg(index));
+
+    openFile();
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "Shared.h"
+
+#include "MpscQueue.h"
+
+#include <atomic>
+
+#include <QtCore/QFile>
+#include <QtCore/QMutex>
+#include <QtCore/QString>
+#include <QtCore/QThread>
+#include <QtCore/QWaitCondition>
+
+// Writes log lines from any thread to stderr and to a dated log file. Producers only push into a lock-free queue, a
+// background thread keeps the file open and rotates it when it grows past the size limit.
+class COMMON_EXPORT Logger : public QThread
+{
+    Q_OBJECT
+
+    public:
+        explicit Logger();
+
+        static Logger& getInstance();
+
+        void initialize(const QString& path, qint64 maxFileSize = 10 * 1024 * 1024);
+        void uninitialize();
+
+        void write(QtMsgType type, const QString& line);
+
+    protected:
+        void run();
+
+    private:
+        MpscQueue<QString> queue;
+        std::atomic<int> droppedLines;
+        std::atomic<bool> running;
+        std::atomic<bool> stopped;
+
+        QMutex drainMutex;
+        QMutex waitMutex;
+        QWaitCondition waitCondition;
+
+        QString path;
+        qint64 maxFileSize = 0;
+        QFile file;
+        QString fileDate;
+
+        void drain();
+        void openFile();
+        void rotateFile();
+};
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+// Bounded, lock-free queue for any number of producer threads and exactly one consumer thread. Every cell carries a
+// sequence number, producers claim a cell by advancing the tail and publish it by bumping the sequence.
+template <typename T>
+class MpscQueue
+{
+    public:
+        explicit MpscQueue(size_t capacity = 1024)
+        {
+            size_t size = 1;
+            while (size < capacity)
+                size <<= 1;
+
+            this->cells.reset(new Cell[size]);
+            this->mask = size - 1;
+
+            for (size_t i = 0; i < size; i++)
+                this->cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        bool push(const T& value)
+        {
+            size_t position = this->tail.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                Cell& cell = this->cells[position & this->mask];
+
+                const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+                const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+                if (difference == 0)
+                {
+                    if (this->tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    {
+                        cell.value = value;
+                        cell.sequence.store(position + 1, std::memory_order_release);
+
+                        return true;
+                    }
+                }
+                else if (difference < 0)
+                {
+                    return false; // Full.
+                }
+                else
+                {
+                    position = this->tail.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        bool pop(T& value)
+        {
+            Cell& cell = this->cells[this->head & this->mask];
+
+            const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            if (static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(this->head + 1) < 0)
+                return false; // Empty.
+
+            value = std::move(cell.value);
+            cell.value = T();
+            cell.sequence.store(this->head + this->mask + 1, std::memory_order_release);
+
+            this->head++;
+
+            return true;
+        }
+
+    private:
+        struct Cell
+        {
+            std::atomic<size_t> sequence;
+            T value;
+        };
+
+        std::unique_ptr<Cell[]> cells;
+        size_t mask = 0;
+
+        size_t head = 0; // Only touched by the consumer.
+        alignas(64) std::atomic<size_t> tail { 0 };
+
+        MpscQueue(const MpscQueue&) = delete;
+        MpscQueue& operator=(const MpscQueue&) = delete;
+};
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// Bounded, lock-free queue for exactly one producer thread and one consumer thread.
+template <typename T>
+class SpscQueue
+{
+    public:
+        explicit SpscQueue(size_t capacity = 1024)
+        {
+            size_t size = 1;
+            while (size < capacity)
+                size <<= 1;
+
+            this->buffer.resize(size);
+            this->mask = size - 1;
+        }
+
+        bool push(const T& value)
+        {
+            const size_t tail = this->tail.load(std::memory_order_relaxed);
+            if (tail - this->head.load(std::memory_order_acquire) == this->buffer.size())
+                return false; // Full.
+
+            this->buffer[tail & this->mask] = value;
+            this->tail.store(tail + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        bool pop(T& value)
+        {
+            const size_t head = this->head.load(std::memory_order_relaxed);
+            if (head == this->tail.load(std::memory_order_acquire))
+                return false; // Empty.
+
+            value = std::move(this->buffer[head & this->mask]);
+            this->buffer[head & this->mask] = T();
+            this->head.store(head + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        bool isEmpty() const
+        {
+            return this->head.load(std::memory_order_acquire) == this->tail.load(std::memory_order_acquire);
+        }
+
+    private:
+        std::vector<T> buffer;
+        size_t mask = 0;
+
+        alignas(64) std::atomic<size_t> head { 0 };
+        alignas(64) std::atomic<size_t> tail { 0 };
+
+        SpscQueue(const SpscQueue&) = delete;
+        SpscQueue& operator=(const SpscQueue&) = delete;
+};
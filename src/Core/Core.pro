@@ -64,6 +64,8 @@ HEADERS += \
     Animations/ActiveAnimation.h \
     Models/ThumbnailModel.h \
     ThumbnailWorker.h \
+    ThumbnailStore.h \
+    LibraryDiffWorker.h \
     Commands/AudioCommand.h \
     Commands/SolidColorCommand.h \
     Events/Inspector/DeviceChangedEvent.h \
@@ -84,6 +86,7 @@ HEADERS += \
     Events/ExportPresetEvent.h \
     Commands/CustomCommand.h \
     OscSubscription.h \
+    PlaybackState.h \
     Events/Inspector/VideolayerChangedEvent.h \
     Models/OscFileModel.h \
     Events/Inspector/AddTemplateDataEvent.h \
@@ -114,6 +117,9 @@ HEADERS += \
     Models/OscOutputModel.h \
     Commands/OscOutputCommand.h \
     Events/OscOutputChangedEvent.h \
+    Events/ConfigurationChangedEvent.h \
+    Events/ThumbnailChangedEvent.h \
+    Events/Library/ThumbnailRequestedEvent.h \
     Models/TriCaster/TriCasterProductModel.h \
     Events/SaveAsPresetEvent.h \
     Events/Rundown/CloseRundownEvent.h \
@@ -249,6 +255,8 @@ SOURCES += \
     Animations/ActiveAnimation.cpp \
     Models/ThumbnailModel.cpp \
     ThumbnailWorker.cpp \
+    ThumbnailStore.cpp \
+    LibraryDiffWorker.cpp \
     Commands/AudioCommand.cpp \
     Commands/SolidColorCommand.cpp \
     Events/Inspector/DeviceChangedEvent.cpp \
@@ -269,6 +277,7 @@ SOURCES += \
     Events/ExportPresetEvent.cpp \
     Commands/CustomCommand.cpp \
     OscSubscription.cpp \
+    PlaybackState.cpp \
     Events/Inspector/VideolayerChangedEvent.cpp \
     Models/OscFileModel.cpp \
     Events/Inspector/AddTemplateDataEvent.cpp \
@@ -299,6 +308,9 @@ SOURCES += \
     Models/OscOutputModel.cpp \
     Commands/OscOutputCommand.cpp \
     Events/OscOutputChangedEvent.cpp \
+    Events/ConfigurationChangedEvent.cpp \
+    Events/ThumbnailChangedEvent.cpp \
+    Events/Library/ThumbnailRequestedEvent.cpp \
     Models/TriCaster/TriCasterProductModel.cpp \
     Events/SaveAsPresetEvent.cpp \
     Events/Rundown/CloseRundownEvent.cpp \
@@ -385,7 +397,12 @@ DISTFILES += \
     Sql/ChangeScript-210.sql \
     Sql/ChangeScript-211.sql \
     Sql/ChangeScript-212.sql \
-    Sql/ChangeScript-213.sql
+    Sql/ChangeScript-213.sql \
+    Sql/ChangeScript-214.sql \
+    Sql/ChangeScript-215.sql \
+    Sql/ChangeScript-216.sql \
+    Sql/ChangeScript-217.sql \
+    Sql/ChangeScript-218.sql
 
 RESOURCES += \
     Core.qrc
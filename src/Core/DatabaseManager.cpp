@@ -1,10 +1,14 @@
 #include "DatabaseManager.h"
+#include "EventManager.h"
+#include "Events/ConfigurationChangedEvent.h"
 
 #include "Version.h"
 
 #include <QtCore/QDebug>
 #include <QtCore/QDir>
+#include <QtCore/QHash>
 #include <QtCore/QMutexLocker>
+#include <QtCore/QRegExp>
 #include <QtCore/QTime>
 #include <QtCore/QVariant>
 
@@ -24,6 +28,20 @@ DatabaseManager& DatabaseManager::getInstance()
     return *databaseManager();
 }
 
+static QString rewriteQuery(QString query, const QSqlDriver* driver)
+{
+    // The scripts are written for MySQL, which needs a key length for indexes on TEXT columns.
+    if (driver->dbmsType() == QSqlDriver::SQLite)
+    {
+        query.remove("AUTO_INCREMENT");
+
+        if (query.trimmed().startsWith("CREATE INDEX"))
+            query.replace(QRegExp("(\\w+)\\(\\d+\\)"), "\\1");
+    }
+
+    return query;
+}
+
 void DatabaseManager::initialize()
 {
     QMutexLocker locker(&mutex);
@@ -32,6 +50,45 @@ void DatabaseManager::initialize()
         createDatabase();
     else
         upgradeDatabase();
+
+    loadConfiguration();
+}
+
+void DatabaseManager::loadConfiguration()
+{
+    // Settings are read all over the application, i.e. several times per rundown item. They are kept in memory
+    // and written through by updateConfiguration().
+    this->configurations.clear();
+
+    QSqlQuery sql;
+    if (!sql.exec("SELECT c.Id, c.Name, c.Value FROM Configuration c"))
+       qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
+
+    while (sql.next())
+        this->configurations.insert(sql.value(1).toString(), ConfigurationModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString()));
+}
+
+void DatabaseManager::uninitialize()
+{
+    QMutexLocker locker(&mutex);
+
+    this->preparedQueries.clear();
+}
+
+QSqlQuery& DatabaseManager::getPreparedQuery(const QString& query)
+{
+    // Statements used on hot paths are prepared once on the default connection and reused. The caller holds the mutex.
+    QHash<QString, QSqlQuery>::iterator iterator = this->preparedQueries.find(query);
+    if (iterator == this->preparedQueries.end())
+    {
+        QSqlQuery sql;
+        if (!sql.prepare(query))
+           qCritical("Failed to prepare sql query: %s, Error: %s", qPrintable(query), qPrintable(sql.lastError().text()));
+
+        iterator = this->preparedQueries.insert(query, sql);
+    }
+
+    return iterator.value();
 }
 
 void DatabaseManager::createDatabase()
@@ -49,10 +106,7 @@ void DatabaseManager::createDatabase()
             if (query.trimmed().isEmpty())
                 continue;
 
-            if (sql.driver()->dbmsType() == QSqlDriver::SQLite)
-                query.remove("AUTO_INCREMENT");
-
-            if (!sql.exec(query))
+            if (!sql.exec(rewriteQuery(query, sql.driver())))
                 qFatal("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
         }
 
@@ -100,7 +154,7 @@ void DatabaseManager::upgradeDatabase()
                  if (query.trimmed().isEmpty())
                      continue;
 
-                 if (!sql.exec(query))
+                 if (!sql.exec(rewriteQuery(query, sql.driver())))
                     qFatal("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
             }
 
@@ -120,26 +174,59 @@ void DatabaseManager::upgradeDatabase()
 
 void DatabaseManager::updateConfiguration(const ConfigurationModel& model)
 {
-    QMutexLocker locker(&mutex);
+    {
+        QMutexLocker locker(&mutex);
 
-    QSqlDatabase::database().transaction();
+        QHash<QString, ConfigurationModel>::const_iterator iterator = this->configurations.find(model.getName());
+        if (iterator != this->configurations.end() && iterator.value().getValue() == model.getValue())
+            return;
 
-    QSqlQuery sql;
-    sql.prepare("UPDATE Configuration SET Value = :Value "
-                "WHERE Name = :Name");
-    sql.bindValue(":Value", model.getValue());
-    sql.bindValue(":Name", model.getName());
+        QSqlDatabase::database().transaction();
 
-    if (!sql.exec())
-       qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
+        QSqlQuery sql;
+        sql.prepare("UPDATE Configuration SET Value = :Value "
+                    "WHERE Name = :Name");
+        sql.bindValue(":Value", model.getValue());
+        sql.bindValue(":Name", model.getName());
 
-    QSqlDatabase::database().commit();
+        if (!sql.exec())
+        {
+            qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
+
+            QSqlDatabase::database().rollback();
+
+            return;
+        }
+
+        if (sql.numRowsAffected() <= 0)
+        {
+            qWarning("Unable to update configuration %s, no such setting", qPrintable(model.getName()));
+
+            QSqlDatabase::database().rollback();
+
+            return;
+        }
+
+        QSqlDatabase::database().commit();
+
+        // Only cached once the database has the value, otherwise it would be lost on restart.
+        int id = (iterator != this->configurations.end()) ? iterator.value().getId() : model.getId();
+        this->configurations.insert(model.getName(), ConfigurationModel(id, model.getName(), model.getValue()));
+    }
+
+    // Notified without holding the lock, listeners usually read other settings.
+    EventManager::getInstance().fireConfigurationChangedEvent(ConfigurationChangedEvent(model.getName(), model.getValue()));
 }
 
 ConfigurationModel DatabaseManager::getConfigurationByName(const QString& name)
 {
     QMutexLocker locker(&mutex);
 
+    QHash<QString, ConfigurationModel>::const_iterator iterator = this->configurations.find(name);
+    if (iterator != this->configurations.end())
+        return iterator.value();
+
+    // Not loaded yet or unknown setting, fall back to the database.
     QSqlQuery sql;
     sql.prepare("SELECT c.Id, c.Name, c.Value FROM Configuration c "
                 "WHERE c.Name = :Name");
@@ -1152,9 +1239,8 @@ DeviceModel DatabaseManager::getDeviceByAddress(const QString& address)
 {
     QMutexLocker locker(&mutex);
 
-    QSqlQuery sql;
-    sql.prepare("SELECT d.Id, d.Name, d.Address, d.Port, d.Username, d.Password, d.Description, d.Version, d.Shadow, d.Channels, d.ChannelFormats, d.PreviewChannel, d.LockedChannel FROM Device d "
-                "WHERE d.Address = :Address");
+    QSqlQuery& sql = getPreparedQuery("SELECT d.Id, d.Name, d.Address, d.Port, d.Username, d.Password, d.Description, d.Version, d.Shadow, d.Channels, d.ChannelFormats, d.PreviewChannel, d.LockedChannel FROM Device d "
+                                      "WHERE d.Address = :Address");
     sql.bindValue(":Address", address);
 
     if (!sql.exec())
@@ -1162,9 +1248,13 @@ DeviceModel DatabaseManager::getDeviceByAddress(const QString& address)
 
     sql.first();
 
-    return DeviceModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString(), sql.value(3).toInt(),
-                       sql.value(4).toString(), sql.value(5).toString(), sql.value(6).toString(), sql.value(7).toString(),
-                       sql.value(8).toString(), sql.value(9).toInt(), sql.value(10).toString(), sql.value(11).toInt(), sql.value(12).toInt());
+    DeviceModel model(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString(), sql.value(3).toInt(),
+                      sql.value(4).toString(), sql.value(5).toString(), sql.value(6).toString(), sql.value(7).toString(),
+                      sql.value(8).toString(), sql.value(9).toInt(), sql.value(10).toString(), sql.value(11).toInt(), sql.value(12).toInt());
+
+    sql.finish();
+
+    return model;
 }
 
 void DatabaseManager::insertDevice(const DeviceModel& model)
@@ -1199,6 +1289,8 @@ void DatabaseManager::updateDevice(const DeviceModel& model)
 {
     QMutexLocker locker(&mutex);
 
+    clearPrefetchedThumbnails();
+
     QSqlDatabase::database().transaction();
 
     QSqlQuery sql;
@@ -1282,6 +1374,8 @@ void DatabaseManager::deleteDevice(int id)
 {
     QMutexLocker locker(&mutex);
 
+    clearPrefetchedThumbnails();
+
     QSqlDatabase::database().transaction();
 
     QSqlQuery sql;
@@ -1537,10 +1631,9 @@ QList<LibraryModel> DatabaseManager::getLibraryMediaByDeviceAddress(const QStrin
 {
     QMutexLocker locker(&mutex);
 
-    QSqlQuery sql;
-    sql.prepare("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t "
-                "WHERE l.DeviceId = d.Id AND l.TypeId = t.Id AND (l.TypeId = 1 OR l.TypeId = 3 OR l.TypeId = 4) AND d.Address = :Address "
-                "ORDER BY l.Id, l.DeviceId");
+    QSqlQuery& sql = getPreparedQuery("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t "
+                                      "WHERE l.DeviceId = d.Id AND l.TypeId = t.Id AND (l.TypeId = 1 OR l.TypeId = 3 OR l.TypeId = 4) AND d.Address = :Address "
+                                      "ORDER BY l.Id, l.DeviceId");
     sql.bindValue(":Address", address);
 
     if (!sql.exec())
@@ -1552,6 +1645,8 @@ QList<LibraryModel> DatabaseManager::getLibraryMediaByDeviceAddress(const QStrin
                                       sql.value(2).toString(), sql.value(3).toString(), sql.value(4).toInt(),
                                       sql.value(5).toString()));
 
+    sql.finish();
+
     return models;
 }
 
@@ -1559,10 +1654,9 @@ QList<LibraryModel> DatabaseManager::getLibraryTemplateByDeviceAddress(const QSt
 {
     QMutexLocker locker(&mutex);
 
-    QSqlQuery sql;
-    sql.prepare("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t "
-                "WHERE l.DeviceId = d.Id AND l.TypeId = t.Id AND l.TypeId = 5 AND d.Address = :Address "
-                "ORDER BY l.Id, l.DeviceId");
+    QSqlQuery& sql = getPreparedQuery("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t "
+                                      "WHERE l.DeviceId = d.Id AND l.TypeId = t.Id AND l.TypeId = 5 AND d.Address = :Address "
+                                      "ORDER BY l.Id, l.DeviceId");
     sql.bindValue(":Address", address);
 
     if (!sql.exec())
@@ -1574,6 +1668,8 @@ QList<LibraryModel> DatabaseManager::getLibraryTemplateByDeviceAddress(const QSt
                                       sql.value(2).toString(), sql.value(3).toString(), sql.value(4).toInt(),
                                       sql.value(5).toString()));
 
+    sql.finish();
+
     return models;
 }
 
@@ -1581,10 +1677,9 @@ QList<LibraryModel> DatabaseManager::getLibraryDataByDeviceAddress(const QString
 {
     QMutexLocker locker(&mutex);
 
-    QSqlQuery sql;
-    sql.prepare("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t "
-                "WHERE l.DeviceId = d.Id AND l.TypeId = t.Id AND l.TypeId = 2 AND d.Address = :Address "
-                "ORDER BY l.Id, l.DeviceId");
+    QSqlQuery& sql = getPreparedQuery("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t "
+                                      "WHERE l.DeviceId = d.Id AND l.TypeId = t.Id AND l.TypeId = 2 AND d.Address = :Address "
+                                      "ORDER BY l.Id, l.DeviceId");
     sql.bindValue(":Address", address);
 
     if (!sql.exec())
@@ -1596,6 +1691,8 @@ QList<LibraryModel> DatabaseManager::getLibraryDataByDeviceAddress(const QString
                                       sql.value(2).toString(), sql.value(3).toString(), sql.value(4).toInt(),
                                       sql.value(5).toString()));
 
+    sql.finish();
+
     return models;
 }
 
@@ -1603,9 +1700,8 @@ QList<LibraryModel> DatabaseManager::getLibraryByNameAndDeviceId(const QString&
 {
     QMutexLocker locker(&mutex);
 
-    QSqlQuery sql;
-    sql.prepare("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t "
-                "WHERE  l.Name = :Name AND l.DeviceId = :DeviceId AND l.DeviceId = d.Id AND l.TypeId = t.Id");
+    QSqlQuery& sql = getPreparedQuery("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t "
+                                      "WHERE  l.Name = :Name AND l.DeviceId = :DeviceId AND l.DeviceId = d.Id AND l.TypeId = t.Id");
     sql.bindValue(":Name", name);
     sql.bindValue(":DeviceId", deviceId);
 
@@ -1618,6 +1714,8 @@ QList<LibraryModel> DatabaseManager::getLibraryByNameAndDeviceId(const QString&
                                       sql.value(2).toString(), sql.value(3).toString(), sql.value(4).toInt(),
                                       sql.value(5).toString()));
 
+    sql.finish();
+
     return models;
 }
 
@@ -1625,49 +1723,57 @@ void DatabaseManager::updateLibraryMedia(const QString& address, const QList<Lib
 {
     QMutexLocker locker(&mutex);
 
+    clearPrefetchedThumbnails();
+
     int deviceId = getDeviceByAddress(address).getId();
     QList<TypeModel> typeModels = getType();
 
     QSqlDatabase::database().transaction();
 
-    QSqlQuery sql;
-
     if (deleteModels.count() > 0)
     {
-        for (int i = 0; i < deleteModels.count(); i++)
-        { 
-            sql.prepare("DELETE FROM Library "
-                        "WHERE Id = :Id");
-            sql.bindValue(":Id", deleteModels.at(i).getId());
+        QVariantList ids;
+        foreach (const LibraryModel& model, deleteModels)
+            ids.push_back(model.getId());
 
-            if (!sql.exec())
-               qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
-        }
+        QSqlQuery& sql = getPreparedQuery("DELETE FROM Library "
+                                          "WHERE Id = ?");
+        sql.addBindValue(ids);
+
+        if (!sql.execBatch())
+           qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
     }
 
     if (insertModels.count() > 0)
     {
-        int typeId;
-        for (int i = 0; i < insertModels.count(); i++)
+        int typeId = 0;
+        QVariantList names, deviceIds, typeIds, thumbnailIds, timecodes;
+        foreach (const LibraryModel& model, insertModels)
         {
-            if (insertModels.at(i).getType() == Rundown::AUDIO)
+            if (model.getType() == Rundown::AUDIO)
                 typeId = std::find_if(typeModels.begin(), typeModels.end(), TypeModel::ByName(Rundown::AUDIO))->getId();
-            else if (insertModels.at(i).getType() == Rundown::MOVIE)
+            else if (model.getType() == Rundown::MOVIE)
                 typeId = std::find_if(typeModels.begin(), typeModels.end(), TypeModel::ByName(Rundown::MOVIE))->getId();
-            else if (insertModels.at(i).getType() == Rundown::STILL)
+            else if (model.getType() == Rundown::STILL)
                 typeId = std::find_if(typeModels.begin(), typeModels.end(), TypeModel::ByName(Rundown::STILL))->getId();
 
-            sql.prepare("INSERT INTO Library (Name, DeviceId, TypeId, ThumbnailId, Timecode) "
-                        "VALUES(:Name, :DeviceId, :TypeId, :ThumbnailId, :Timecode)");
-            sql.bindValue(":Name", insertModels.at(i).getName());
-            sql.bindValue(":DeviceId", deviceId);
-            sql.bindValue(":TypeId", typeId);
-            sql.bindValue(":ThumbnailId", insertModels.at(i).getThumbnailId());
-            sql.bindValue(":Timecode", insertModels.at(i).getTimecode());
-
-            if (!sql.exec())
-               qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
+            names.push_back(model.getName());
+            deviceIds.push_back(deviceId);
+            typeIds.push_back(typeId);
+            thumbnailIds.push_back(model.getThumbnailId());
+            timecodes.push_back(model.getTimecode());
         }
+
+        QSqlQuery& sql = getPreparedQuery("INSERT INTO Library (Name, DeviceId, TypeId, ThumbnailId, Timecode) "
+                                          "VALUES(?, ?, ?, ?, ?)");
+        sql.addBindValue(names);
+        sql.addBindValue(deviceIds);
+        sql.addBindValue(typeIds);
+        sql.addBindValue(thumbnailIds);
+        sql.addBindValue(timecodes);
+
+        if (!sql.execBatch())
+           qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
     }
 
     QSqlDatabase::database().commit();
@@ -1677,41 +1783,50 @@ void DatabaseManager::updateLibraryTemplate(const QString& address, const QList<
 {
     QMutexLocker locker(&mutex);
 
+    clearPrefetchedThumbnails();
+
     int deviceId = getDeviceByAddress(address).getId();
     QList<TypeModel> typeModels = getType();
     int typeId = std::find_if(typeModels.begin(), typeModels.end(), TypeModel::ByName(Rundown::TEMPLATE))->getId();
 
     QSqlDatabase::database().transaction();
 
-    QSqlQuery sql;
     if (deleteModels.count() > 0)
     {
-        for (int i = 0; i < deleteModels.count(); i++)
-        {
-            sql.prepare("DELETE FROM Library "
-                        "WHERE Id = :Id");
-            sql.bindValue(":Id", deleteModels.at(i).getId());
+        QVariantList ids;
+        foreach (const LibraryModel& model, deleteModels)
+            ids.push_back(model.getId());
 
-            if (!sql.exec())
-               qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
-        }
+        QSqlQuery& sql = getPreparedQuery("DELETE FROM Library "
+                                          "WHERE Id = ?");
+        sql.addBindValue(ids);
+
+        if (!sql.execBatch())
+           qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
     }
 
     if (insertModels.count() > 0)
     {
-        for (int i = 0; i < insertModels.count(); i++)
+        QVariantList names, deviceIds, typeIds, thumbnailIds, timecodes;
+        foreach (const LibraryModel& model, insertModels)
         {
-            sql.prepare("INSERT INTO Library (Name, DeviceId, TypeId, ThumbnailId, Timecode) "
-                        "VALUES(:Name, :DeviceId, :TypeId, :ThumbnailId, :Timecode)");
-            sql.bindValue(":Name", insertModels.at(i).getName());
-            sql.bindValue(":DeviceId", deviceId);
-            sql.bindValue(":TypeId", typeId);
-            sql.bindValue(":ThumbnailId", insertModels.at(i).getThumbnailId());
-            sql.bindValue(":Timecode", insertModels.at(i).getTimecode());
-
-            if (!sql.exec())
-               qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
+            names.push_back(model.getName());
+            deviceIds.push_back(deviceId);
+            typeIds.push_back(typeId);
+            thumbnailIds.push_back(model.getThumbnailId());
+            timecodes.push_back(model.getTimecode());
         }
+
+        QSqlQuery& sql = getPreparedQuery("INSERT INTO Library (Name, DeviceId, TypeId, ThumbnailId, Timecode) "
+                                          "VALUES(?, ?, ?, ?, ?)");
+        sql.addBindValue(names);
+        sql.addBindValue(deviceIds);
+        sql.addBindValue(typeIds);
+        sql.addBindValue(thumbnailIds);
+        sql.addBindValue(timecodes);
+
+        if (!sql.execBatch())
+           qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
     }
 
     QSqlDatabase::database().commit();
@@ -1721,51 +1836,63 @@ void DatabaseManager::updateLibraryData(const QString& address, const QList<Libr
 {
     QMutexLocker locker(&mutex);
 
+    clearPrefetchedThumbnails();
+
     int deviceId = getDeviceByAddress(address).getId();
     QList<TypeModel> typeModels = getType();
 
     QSqlDatabase::database().transaction();
 
-    QSqlQuery sql;
     if (deleteModels.count() > 0)
     {
-        for (int i = 0; i < deleteModels.count(); i++)
+        QVariantList ids, thumbnailIds;
+        foreach (const LibraryModel& model, deleteModels)
         {
-            sql.prepare("DELETE FROM Thumbnail "
-                        "WHERE Id = :Id");
-            sql.bindValue(":Id", deleteModels.at(i).getThumbnailId());
+            ids.push_back(model.getId());
+            thumbnailIds.push_back(model.getThumbnailId());
+        }
 
-            if (!sql.exec())
-               qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
+        QSqlQuery& deleteThumbnail = getPreparedQuery("DELETE FROM Thumbnail "
+                                                      "WHERE Id = ?");
+        deleteThumbnail.addBindValue(thumbnailIds);
 
-            sql.prepare("DELETE FROM Library "
-                        "WHERE Id = :Id AND TypeId = 2");
-            sql.bindValue(":Id", deleteModels.at(i).getId());
+        if (!deleteThumbnail.execBatch())
+           qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(deleteThumbnail.lastQuery()), qPrintable(deleteThumbnail.lastError().text()));
 
-            if (!sql.exec())
-               qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
-        }
+        QSqlQuery& deleteLibrary = getPreparedQuery("DELETE FROM Library "
+                                                    "WHERE Id = ? AND TypeId = 2");
+        deleteLibrary.addBindValue(ids);
+
+        if (!deleteLibrary.execBatch())
+           qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(deleteLibrary.lastQuery()), qPrintable(deleteLibrary.lastError().text()));
     }
 
     if (insertModels.count() > 0)
     {
-        int typeId;
-        for (int i = 0; i < insertModels.count(); i++)
+        int typeId = 0;
+        QVariantList names, deviceIds, typeIds, thumbnailIds, timecodes;
+        foreach (const LibraryModel& model, insertModels)
         {
-            if (insertModels.at(i).getType() == "DATA")
+            if (model.getType() == "DATA")
                 typeId = std::find_if(typeModels.begin(), typeModels.end(), TypeModel::ByName("DATA"))->getId();
 
-            sql.prepare("INSERT INTO Library (Name, DeviceId, TypeId, ThumbnailId, Timecode) "
-                        "VALUES(:Name, :DeviceId, :TypeId, :ThumbnailId, :Timecode)");
-            sql.bindValue(":Name", insertModels.at(i).getName());
-            sql.bindValue(":DeviceId", deviceId);
-            sql.bindValue(":TypeId", typeId);
-            sql.bindValue(":ThumbnailId", insertModels.at(i).getThumbnailId());
-            sql.bindValue(":Timecode", insertModels.at(i).getTimecode());
-
-            if (!sql.exec())
-               qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
+            names.push_back(model.getName());
+            deviceIds.push_back(deviceId);
+            typeIds.push_back(typeId);
+            thumbnailIds.push_back(model.getThumbnailId());
+            timecodes.push_back(model.getTimecode());
         }
+
+        QSqlQuery& sql = getPreparedQuery("INSERT INTO Library (Name, DeviceId, TypeId, ThumbnailId, Timecode) "
+                                          "VALUES(?, ?, ?, ?, ?)");
+        sql.addBindValue(names);
+        sql.addBindValue(deviceIds);
+        sql.addBindValue(typeIds);
+        sql.addBindValue(thumbnailIds);
+        sql.addBindValue(timecodes);
+
+        if (!sql.execBatch())
+           qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
     }
 
     QSqlDatabase::database().commit();
@@ -1775,6 +1902,8 @@ void DatabaseManager::deleteLibrary(int deviceId)
 {
     QMutexLocker locker(&mutex);
 
+    clearPrefetchedThumbnails();
+
     QSqlDatabase::database().transaction();
 
     QSqlQuery sql;
@@ -1792,9 +1921,8 @@ QList<ThumbnailModel> DatabaseManager::getThumbnailByDeviceAddress(const QString
 {
     QMutexLocker locker(&mutex);
 
-    QSqlQuery sql;
-    sql.prepare("SELECT t.Id, t.Data, t.Timestamp, t.Size, l.Name, d.Address FROM Thumbnail t, Library l, Device d "
-                "WHERE d.Address = :Address AND l.DeviceId = d.Id AND l.ThumbnailId = t.Id");
+    QSqlQuery& sql = getPreparedQuery("SELECT t.Id, t.Data, t.Timestamp, t.Size, l.Name, d.Address FROM Thumbnail t, Library l, Device d "
+                                      "WHERE d.Address = :Address AND l.DeviceId = d.Id AND l.ThumbnailId = t.Id");
     sql.bindValue(":Address", address);
 
     if (!sql.exec())
@@ -1805,16 +1933,54 @@ QList<ThumbnailModel> DatabaseManager::getThumbnailByDeviceAddress(const QString
         models.push_back(ThumbnailModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString(),
                                         sql.value(3).toString(), sql.value(4).toString(), sql.value(5).toString()));
 
+    sql.finish();
+
     return models;
 }
 
-ThumbnailModel DatabaseManager::getThumbnailByNameAndDeviceName(const QString& name, const QString& deviceName)
+void DatabaseManager::prefetchThumbnails()
 {
     QMutexLocker locker(&mutex);
 
+    if (this->thumbnailsPrefetched)
+        return;
+
+    QTime time;
+    time.start();
+
+    // One set-based query instead of a lookup per rundown item. Items without a thumbnail are absent and are
+    // answered from the cache as well.
     QSqlQuery sql;
-    sql.prepare("SELECT t.Id, t.Data, t.Timestamp, t.Size, l.Name, d.Name, d.Address FROM Thumbnail t, Library l, Device d "
-                "WHERE l.Name = :Name AND d.Name = :DeviceName AND l.ThumbnailId = t.Id");
+    if (!sql.exec("SELECT t.Id, t.Data, t.Timestamp, t.Size, l.Name, d.Name FROM Thumbnail t, Library l, Device d "
+                  "WHERE l.DeviceId = d.Id AND l.ThumbnailId = t.Id"))
+       qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
+
+    while (sql.next())
+        this->prefetchedThumbnails.insert(sql.value(5).toString() + '\n' + sql.value(4).toString(),
+                                          ThumbnailModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString(),
+                                                         sql.value(3).toString(), sql.value(4).toString(), sql.value(5).toString()));
+
+    this->thumbnailsPrefetched = true;
+
+    qDebug("DatabaseManager::prefetchThumbnails %d msec (%d thumbnails)", time.elapsed(), this->prefetchedThumbnails.count());
+}
+
+void DatabaseManager::clearPrefetchedThumbnails()
+{
+    // Called on every write that may change a thumbnail, lookups use the database until the next prefetch.
+    this->prefetchedThumbnails.clear();
+    this->thumbnailsPrefetched = false;
+}
+
+ThumbnailModel DatabaseManager::getThumbnailByNameAndDeviceName(const QString& name, const QString& deviceName)
+{
+    QMutexLocker locker(&mutex);
+
+    if (this->thumbnailsPrefetched)
+        return this->prefetchedThumbnails.value(deviceName + '\n' + name, ThumbnailModel(0, QString(), QString(), QString(), QString(), QString()));
+
+    QSqlQuery& sql = getPreparedQuery("SELECT t.Id, t.Data, t.Timestamp, t.Size, l.Name, d.Name FROM Thumbnail t, Library l, Device d "
+                                      "WHERE l.Name = :Name AND d.Name = :DeviceName AND l.DeviceId = d.Id AND l.ThumbnailId = t.Id");
     sql.bindValue(":Name", name);
     sql.bindValue(":DeviceName", deviceName);
 
@@ -1823,29 +1989,54 @@ ThumbnailModel DatabaseManager::getThumbnailByNameAndDeviceName(const QString& n
 
     sql.first();
 
-    return ThumbnailModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString(),
-                          sql.value(3).toString(), sql.value(4).toString(), sql.value(5).toString());
+    ThumbnailModel model(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString(),
+                         sql.value(3).toString(), sql.value(4).toString(), sql.value(5).toString());
+
+    sql.finish();
+
+    return model;
+}
+
+QStringList DatabaseManager::getThumbnailKeys()
+{
+    QMutexLocker locker(&mutex);
+
+    QSqlQuery sql;
+    if (!sql.exec("SELECT t.Data FROM Thumbnail t"))
+       qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
+
+    QStringList keys;
+    while (sql.next())
+        keys.push_back(sql.value(0).toString());
+
+    return keys;
 }
 
 void DatabaseManager::updateThumbnail(const ThumbnailModel& model)
+{
+    updateThumbnails(QList<ThumbnailModel>() << model);
+}
+
+void DatabaseManager::updateThumbnails(const QList<ThumbnailModel>& models)
 {
     QMutexLocker locker(&mutex);
 
-    int deviceId = getDeviceByAddress(model.getAddress()).getId();
-    const QList<LibraryModel>& libraryModels = getLibraryByNameAndDeviceId(model.getName(), deviceId);
+    clearPrefetchedThumbnails();
 
     QSqlDatabase::database().transaction();
 
-    QSqlQuery sql;
-    if (libraryModels.count() > 0)
+    foreach (const ThumbnailModel& model, models)
     {
+        int deviceId = getDeviceByAddress(model.getAddress()).getId();
+        const QList<LibraryModel>& libraryModels = getLibraryByNameAndDeviceId(model.getName(), deviceId);
+
         for (int i = 0; i < libraryModels.count(); i++)
         {
             const LibraryModel& libraryModel = libraryModels.at(i);
             if (libraryModel.getThumbnailId() > 0)
             {
-                sql.prepare("UPDATE Thumbnail SET Data = :Data, Timestamp = :Timestamp, Size = :Size "
-                            "WHERE Id = :Id");
+                QSqlQuery& sql = getPreparedQuery("UPDATE Thumbnail SET Data = :Data, Timestamp = :Timestamp, Size = :Size "
+                                                  "WHERE Id = :Id");
                 sql.bindValue(":Data", model.getData());
                 sql.bindValue(":Timestamp", model.getTimestamp());
                 sql.bindValue(":Size", model.getSize());
@@ -1856,8 +2047,8 @@ void DatabaseManager::updateThumbnail(const ThumbnailModel& model)
             }
             else
             {
-                sql.prepare("INSERT INTO Thumbnail (Data, Timestamp, Size) "
-                            "VALUES(:Data, :Timestamp, :Size)");
+                QSqlQuery& sql = getPreparedQuery("INSERT INTO Thumbnail (Data, Timestamp, Size) "
+                                                  "VALUES(:Data, :Timestamp, :Size)");
                 sql.bindValue(":Data", model.getData());
                 sql.bindValue(":Timestamp", model.getTimestamp());
                 sql.bindValue(":Size", model.getSize());
@@ -1866,13 +2057,14 @@ void DatabaseManager::updateThumbnail(const ThumbnailModel& model)
                    qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
                 int lastInsertId = sql.lastInsertId().toInt();
-                sql.prepare("UPDATE Library SET ThumbnailId = :ThumbnailId "
-                            "WHERE Id = :Id");
-                sql.bindValue(":ThumbnailId", lastInsertId);
-                sql.bindValue(":Id", libraryModel.getId());
 
-                if (!sql.exec())
-                   qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
+                QSqlQuery& updateLibrary = getPreparedQuery("UPDATE Library SET ThumbnailId = :ThumbnailId "
+                                                            "WHERE Id = :Id");
+                updateLibrary.bindValue(":ThumbnailId", lastInsertId);
+                updateLibrary.bindValue(":Id", libraryModel.getId());
+
+                if (!updateLibrary.exec())
+                   qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(updateLibrary.lastQuery()), qPrintable(updateLibrary.lastError().text()));
             }
         }
     }
@@ -1884,25 +2076,29 @@ void DatabaseManager::deleteThumbnails()
 {
     QMutexLocker locker(&mutex);
 
+    clearPrefetchedThumbnails();
+
     QSqlDatabase::database().transaction();
 
     QSqlQuery sql;
     if (!sql.exec("DELETE FROM Thumbnail"))
        qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
 
-    const QList<LibraryModel>& models = this->getLibraryMedia();
-    for (int i = 0; i < models.count(); i++)
+    QVariantList ids;
+    foreach (const LibraryModel& model, this->getLibraryMedia())
     {
-        const LibraryModel& model = models.at(i);
         if (model.getThumbnailId() > 0)
-        {
-            sql.prepare("UPDATE Library SET ThumbnailId = 0 "
-                        "WHERE Id = :Id");
-            sql.bindValue(":Id", model.getId());
+            ids.push_back(model.getId());
+    }
 
-            if (!sql.exec())
-               qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
-        }
+    if (ids.count() > 0)
+    {
+        sql.prepare("UPDATE Library SET ThumbnailId = 0 "
+                    "WHERE Id = ?");
+        sql.addBindValue(ids);
+
+        if (!sql.execBatch())
+           qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
     }
 
     QSqlDatabase::database().commit();
@@ -39,8 +39,12 @@
 #include "Models/TriCaster/TriCasterDeviceModel.h"
 #include "Models/TriCaster/TriCasterNetworkTargetModel.h"
 
+#include <QtCore/QHash>
 #include <QtCore/QMutex>
 #include <QtCore/QObject>
+#include <QtCore/QStringList>
+
+#include <QtSql/QSqlQuery>
 
 class CORE_EXPORT DatabaseManager
 {
@@ -50,7 +54,7 @@ class CORE_EXPORT DatabaseManager
         static DatabaseManager& getInstance();
 
         void initialize();
-        void uninitialize() {}
+        void uninitialize();
 
         ConfigurationModel getConfigurationByName(const QString& name);
         void updateConfiguration(const ConfigurationModel& model);
@@ -148,12 +152,23 @@ class CORE_EXPORT DatabaseManager
 
         QList<ThumbnailModel> getThumbnailByDeviceAddress(const QString& address);
         ThumbnailModel getThumbnailByNameAndDeviceName(const QString& name, const QString& deviceName);
+        void prefetchThumbnails();
+        QStringList getThumbnailKeys();
         void updateThumbnail(const ThumbnailModel& model);
+        void updateThumbnails(const QList<ThumbnailModel>& models);
         void deleteThumbnails();
 
     private:
         QMutex mutex;
+        QHash<QString, QSqlQuery> preparedQueries;
+        QHash<QString, ConfigurationModel> configurations;
+        QHash<QString, ThumbnailModel> prefetchedThumbnails;
+        bool thumbnailsPrefetched = false;
+
+        QSqlQuery& getPreparedQuery(const QString& query);
 
         void createDatabase();
         void upgradeDatabase();
+        void loadConfiguration();
+        void clearPrefetchedThumbnails();
 };
@@ -13,12 +13,25 @@
 #include <QtCore/QSharedPointer>
 #include <QtCore/QStringList>
 
+#include <QtNetwork/QHostAddress>
+#include <QtNetwork/QHostInfo>
+
 #include <QtWidgets/QApplication>
 
 Q_GLOBAL_STATIC(DeviceManager, deviceManager)
 
+static const int RESOLVE_TTL = 5 * 60 * 1000;
+static const int RESOLVE_RETRY_DELAY = 2 * 1000;
+
 DeviceManager::DeviceManager()
+    : emptyBroadcastGroup(new CasparDeviceGroup())
 {
+    this->resolveTimer.setInterval(RESOLVE_TTL);
+
+    this->retryTimer.setSingleShot(true);
+
+    QObject::connect(&this->resolveTimer, SIGNAL(timeout()), this, SLOT(refreshAddresses()));
+    QObject::connect(&this->retryTimer, SIGNAL(timeout()), this, SLOT(retryAddresses()));
 }
 
 DeviceManager& DeviceManager::getInstance()
@@ -30,20 +43,24 @@ void DeviceManager::initialize()
 {
     QList<DeviceModel> models = DatabaseManager::getInstance().getDevice();
     foreach (const DeviceModel& model, models)
-    {
-        QSharedPointer<CasparDevice> device(new CasparDevice(model.getAddress(), model.getPort()));
-
-        this->deviceModels.insert(model.getName(), model);
-        this->devices.insert(model.getName(), device);
+        addDevice(model);
 
-        emit deviceAdded(*device);
+    updateBroadcastGroups();
 
-        device->connectDevice();
-    }
+    this->resolveTimer.start();
 }
 
 void DeviceManager::uninitialize()
 {
+    this->resolveTimer.stop();
+    this->retryTimer.stop();
+    this->retryDelays.clear();
+
+    foreach (int lookupId, this->pendingLookups.keys())
+        QHostInfo::abortHostLookup(lookupId);
+
+    this->pendingLookups.clear();
+
     foreach (const QString& key, this->devices.keys())
     {
         QSharedPointer<CasparDevice>& device = this->devices[key];
@@ -76,6 +93,8 @@ void DeviceManager::refresh()
 
             this->devices.remove(key);
             this->deviceModels.remove(key);
+            this->broadcastGroups.remove(key);
+            this->retryDelays.remove(key);
 
             emit deviceRemoved();
         }
@@ -85,16 +104,138 @@ void DeviceManager::refresh()
     foreach (DeviceModel model, models)
     {
         if (!this->devices.contains(model.getName()))
-        {
-            QSharedPointer<CasparDevice> device(new CasparDevice(model.getAddress(), model.getPort()));
+            addDevice(model);
+        else
+            this->deviceModels.insert(model.getName(), model); // The shadow setting may have changed.
+    }
+
+    updateBroadcastGroups();
+}
+
+void DeviceManager::addDevice(const DeviceModel& model)
+{
+    QSharedPointer<CasparDevice> device(new CasparDevice(model.getAddress(), model.getPort()));
+
+    this->deviceModels.insert(model.getName(), model);
+    this->devices.insert(model.getName(), device);
+    this->broadcastGroups.insert(model.getName(), QSharedPointer<CasparDeviceGroup>(new CasparDeviceGroup()));
+
+    // Connected before anyone else gets the device, the groups are up to date when other listeners are notified.
+    QObject::connect(device.data(), SIGNAL(connectionStateChanged(CasparDevice&)), this, SLOT(deviceConnectionStateChanged(CasparDevice&)));
+
+    emit deviceAdded(*device);
+
+    resolveAddress(model.getName());
+
+    device->connectDevice();
+}
+
+void DeviceManager::deviceConnectionStateChanged(CasparDevice& device)
+{
+    updateBroadcastGroups();
+
+    if (device.isConnected())
+    {
+        const QSharedPointer<DeviceModel> model = getDeviceModelByAddress(device.getAddress());
+        if (model != NULL)
+            resolveAddress(model->getName());
+    }
+}
+
+void DeviceManager::refreshAddresses()
+{
+    foreach (const QString& name, this->devices.keys())
+        resolveAddress(name);
+}
+
+void DeviceManager::retryAddresses()
+{
+    foreach (const QString& name, this->retryDelays.keys())
+    {
+        if (this->devices.contains(name))
+            resolveAddress(name);
+        else
+            this->retryDelays.remove(name);
+    }
+}
+
+void DeviceManager::resolveAddress(const QString& name)
+{
+    const QString& address = this->devices[name]->getAddress();
+    if (address == "localhost" || !QHostAddress(address).isNull())
+        return; // Nothing to resolve.
+
+    if (this->pendingLookups.values().contains(name))
+        return; // Already in progress.
+
+    int lookupId = QHostInfo::lookupHost(address, this, SLOT(addressResolved(QHostInfo)));
+    this->pendingLookups.insert(lookupId, name);
+}
+
+void DeviceManager::addressResolved(const QHostInfo& hostInfo)
+{
+    const QString name = this->pendingLookups.take(hostInfo.lookupId());
+    if (!this->devices.contains(name))
+        return; // Removed while the lookup was in progress.
+
+    const QSharedPointer<CasparDevice>& device = this->devices[name];
 
-            this->deviceModels.insert(model.getName(), model);
-            this->devices.insert(model.getName(), device);
+    // Keep the last known address when the lookup fails and retry with a doubling delay, up to the refresh interval.
+    if (hostInfo.error() != QHostInfo::NoError || hostInfo.addresses().isEmpty())
+    {
+        int delay = qMin(RESOLVE_TTL, this->retryDelays.value(name, RESOLVE_RETRY_DELAY / 2) * 2);
+        this->retryDelays.insert(name, delay);
+
+        if (!this->retryTimer.isActive() || this->retryTimer.remainingTime() > delay)
+            this->retryTimer.start(delay);
+
+        qWarning("Unable to resolve %s, retrying in %d sec: %s", qPrintable(device->getAddress()), delay / 1000, qPrintable(hostInfo.errorString()));
+        return;
+    }
+
+    this->retryDelays.remove(name);
+
+    const QString address = hostInfo.addresses().at(0).toString();
+    if (address == device->resolveIpAddress())
+        return;
+
+    qDebug("Resolved %s to %s", qPrintable(device->getAddress()), qPrintable(address));
+
+    device->setResolvedAddress(address);
+
+    emit deviceAddressChanged(*device);
+}
+
+void DeviceManager::updateBroadcastGroups()
+{
+    // Resolved here once per connection change instead of once per command, a group holds the connected
+    // primary device followed by every connected shadow device.
+    QList<QSharedPointer<CasparDevice>> shadowDevices;
+    foreach (const QString& key, this->deviceModels.keys())
+    {
+        if (this->deviceModels[key].getShadow() == "No")
+            continue;
+
+        const QSharedPointer<CasparDevice>& device = this->devices[key];
+        if (device->isConnected())
+            shadowDevices.append(device);
+    }
+
+    foreach (const QString& key, this->broadcastGroups.keys())
+    {
+        const QSharedPointer<CasparDevice>& primaryDevice = this->devices[key];
 
-            emit deviceAdded(*device);
+        QList<QSharedPointer<CasparDevice>> devices;
+        if (primaryDevice->isConnected())
+            devices.append(primaryDevice);
 
-            device->connectDevice();
+        foreach (const QSharedPointer<CasparDevice>& device, shadowDevices)
+        {
+            if (device != primaryDevice)
+                devices.append(device);
         }
+
+        this->broadcastGroups[key]->setDevices(devices);
     }
 }
 
@@ -142,3 +283,53 @@ const QSharedPointer<CasparDevice> DeviceManager::getDeviceByName(const QString&
 {
     return this->devices.value(name);
 }
+
+const QSharedPointer<CasparDeviceGroup> DeviceManager::getBroadcastGroupByName(const QString& name) const
+{
+    // Never null, commands written to an unknown or disconnected device are dropped by the empty group.
+    return this->broadcastGroups.value(name, this->emptyBroadcastGroup);
+}
+
+void DeviceManager::beginBatch()
+{
+    foreach (const QSharedPointer<CasparDevice>& device, this->devices)
+        device->beginBatch();
+}
+
+void DeviceManager::endBatch()
+{
+    foreach (const QSharedPointer<CasparDevice>& device, this->devices)
+        device->endBatch();
+}
+
+int DeviceManager::beginBatch(const QMap<QString, QStringList>& channels, bool deferMixer)
+{
+    int token = this->nextBatchToken++;
+
+    QStringList shadowChannels;
+    foreach (const QStringList& deviceChannels, channels)
+        shadowChannels.append(deviceChannels);
+
+    shadowChannels.removeDuplicates();
+
+    foreach (const QString& key, this->devices.keys())
+    {
+        QStringList deviceChannels = channels.value(key);
+        if (this->deviceModels[key].getShadow() != "No")
+        {
+            deviceChannels.append(shadowChannels);
+            deviceChannels.removeDuplicates();
+        }
+
+        if (!deviceChannels.isEmpty())
+            this->devices[key]->beginBatch(token, deviceChannels, deferMixer);
+    }
+
+    return token;
+}
+
+void DeviceManager::endBatch(int token)
+{
+    foreach (const QSharedPointer<CasparDevice>& device, this->devices)
+        device->endBatch(token);
+}
@@ -4,10 +4,14 @@
 #include "Models/DeviceModel.h"
 
 #include "CasparDevice.h"
+#include "CasparDeviceGroup.h"
 
 #include <QtCore/QMap>
 #include <QtCore/QObject>
 #include <QtCore/QSharedPointer>
+#include <QtCore/QTimer>
+
+class QHostInfo;
 
 class CORE_EXPORT DeviceManager : public QObject
 {
@@ -28,12 +32,39 @@ class CORE_EXPORT DeviceManager : public QObject
 
         int getDeviceCount() const;
         const QSharedPointer<CasparDevice> getDeviceByName(const QString& name) const;
+        const QSharedPointer<CasparDeviceGroup> getBroadcastGroupByName(const QString& name) const;
+
+        void beginBatch();
+        void endBatch();
+
+        // Holds the commands for the given channels per device name until endBatch() with the returned token,
+        // shadow devices hold the channels of every device.
+        int beginBatch(const QMap<QString, QStringList>& channels, bool deferMixer);
+        void endBatch(int token);
 
         Q_SIGNAL void deviceRemoved();
         Q_SIGNAL void deviceAdded(CasparDevice&);
+        Q_SIGNAL void deviceAddressChanged(CasparDevice&);
 
     private:
         QMap<QString, DeviceModel> deviceModels;
         QMap<QString, QSharedPointer<CasparDevice>> devices;
+        QMap<QString, QSharedPointer<CasparDeviceGroup>> broadcastGroups;
+        QSharedPointer<CasparDeviceGroup> emptyBroadcastGroup;
+        int nextBatchToken = 1;
+
+        QTimer resolveTimer;
+        QTimer retryTimer;
+        QMap<int, QString> pendingLookups;
+        QMap<QString, int> retryDelays;
+
+        void addDevice(const DeviceModel& model);
+        void updateBroadcastGroups();
+        void resolveAddress(const QString& name);
+
+        Q_SLOT void deviceConnectionStateChanged(CasparDevice&);
+        Q_SLOT void addressResolved(const QHostInfo&);
+        Q_SLOT void refreshAddresses();
+        Q_SLOT void retryAddresses();
 };
 
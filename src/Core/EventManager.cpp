@@ -1,5 +1,8 @@
 #include "EventManager.h"
 
+#include <QtCore/QMetaMethod>
+#include <QtCore/QMetaObject>
+
 #include <QtWidgets/QApplication>
 
 Q_GLOBAL_STATIC(EventManager, eventManager)
@@ -13,6 +16,20 @@ EventManager& EventManager::getInstance()
     return *eventManager();
 }
 
+void EventManager::sendToSelectedRundownItem(const char* method, QGenericArgument argument)
+{
+    if (this->selectedRundownItem.isNull())
+        return;
+
+    const QMetaObject* metaObject = this->selectedRundownItem->metaObject();
+
+    int index = metaObject->indexOfSlot(method);
+    if (index == -1)
+        return; // The item does not handle this event.
+
+    metaObject->method(index).invoke(this->selectedRundownItem.data(), Qt::DirectConnection, argument);
+}
+
 void EventManager::initialize()
 {
 }
@@ -176,8 +193,15 @@ void EventManager::fireOscOutputChangedEvent(const OscOutputChangedEvent& event)
     emit oscOutputChanged(event);
 }
 
+void EventManager::fireConfigurationChangedEvent(const ConfigurationChangedEvent& event)
+{
+    emit configurationChanged(event);
+}
+
 void EventManager::fireRundownItemSelectedEvent(const RundownItemSelectedEvent& event)
 {
+    this->selectedRundownItem = event.getSource();
+
     emit rundownItemSelected(event);
 }
 
@@ -231,6 +255,16 @@ void EventManager::fireMediaChangedEvent(const MediaChangedEvent& event)
     emit mediaChanged(event);
 }
 
+void EventManager::fireThumbnailChangedEvent(const ThumbnailChangedEvent& event)
+{
+    emit thumbnailChanged(event);
+}
+
+void EventManager::fireThumbnailRequestedEvent(const ThumbnailRequestedEvent& event)
+{
+    emit thumbnailRequested(event);
+}
+
 void EventManager::fireTemplateChangedEvent(const TemplateChangedEvent& event)
 {
     emit templateChanged(event);
@@ -279,26 +313,36 @@ void EventManager::firePreviewEvent(const PreviewEvent& event)
 void EventManager::fireChannelChangedEvent(const ChannelChangedEvent& event)
 {
     emit channelChanged(event);
+
+    sendToSelectedRundownItem("channelChanged(ChannelChangedEvent)", Q_ARG(ChannelChangedEvent, event));
 }
 
 void EventManager::fireVideolayerChangedEvent(const VideolayerChangedEvent& event)
 {
     emit videolayerChanged(event);
+
+    sendToSelectedRundownItem("videolayerChanged(VideolayerChangedEvent)", Q_ARG(VideolayerChangedEvent, event));
 }
 
 void EventManager::fireLabelChangedEvent(const LabelChangedEvent& event)
 {
     emit labelChanged(event);
+
+    sendToSelectedRundownItem("labelChanged(LabelChangedEvent)", Q_ARG(LabelChangedEvent, event));
 }
 
 void EventManager::fireTargetChangedEvent(const TargetChangedEvent& event)
 {
     emit targetChanged(event);
+
+    sendToSelectedRundownItem("targetChanged(TargetChangedEvent)", Q_ARG(TargetChangedEvent, event));
 }
 
 void EventManager::fireDeviceChangedEvent(const DeviceChangedEvent& event)
 {
     emit deviceChanged(event);
+
+    sendToSelectedRundownItem("deviceChanged(DeviceChangedEvent)", Q_ARG(DeviceChangedEvent, event));
 }
 
 void EventManager::fireAutoPlayNextRundownItemEvent(const AutoPlayNextRundownItemEvent& event)
@@ -309,6 +353,8 @@ void EventManager::fireAutoPlayNextRundownItemEvent(const AutoPlayNextRundownIte
 void EventManager::fireAutoPlayChangedEvent(const AutoPlayChangedEvent& event)
 {
     emit autoPlayChanged(event);
+
+    sendToSelectedRundownItem("autoPlayChanged(AutoPlayChangedEvent)", Q_ARG(AutoPlayChangedEvent, event));
 }
 
 void EventManager::fireSaveAsPresetEvent(const SaveAsPresetEvent& event)
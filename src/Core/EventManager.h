@@ -15,8 +15,10 @@
 #include "Events/PreviewEvent.h"
 #include "Events/SaveAsPresetEvent.h"
 #include "Events/StatusbarEvent.h"
+#include "Events/ThumbnailChangedEvent.h"
 #include "Events/DurationChangedEvent.h"
 #include "Events/CloseApplicationEvent.h"
+#include "Events/ConfigurationChangedEvent.h"
 #include "Events/ExportPresetMenuEvent.h"
 #include "Events/SaveAsPresetMenuEvent.h"
 #include "Events/ToggleFullscreenEvent.h"
@@ -36,6 +38,7 @@
 #include "Events/Library/AutoRefreshLibraryEvent.h"
 #include "Events/Library/RefreshLibraryEvent.h"
 #include "Events/Library/LibraryFilterChangedEvent.h"
+#include "Events/Library/ThumbnailRequestedEvent.h"
 #include "Events/Rundown/ActiveRundownChangedEvent.h"
 #include "Events/Rundown/AddRudnownItemEvent.h"
 #include "Events/Rundown/AllowRemoteTriggeringMenuEvent.h"
@@ -76,6 +79,7 @@
 #include "Models/LibraryModel.h"
 
 #include <QtCore/QObject>
+#include <QtCore/QPointer>
 
 #include <QtWidgets/QWidget>
 #include <QtWidgets/QTreeWidgetItem>
@@ -108,6 +112,7 @@ class CORE_EXPORT EventManager : public QObject
         Q_SIGNAL void addTemplateData(const AddTemplateDataEvent&);
         Q_SIGNAL void saveRundown(const SaveRundownEvent&);
         Q_SIGNAL void oscOutputChanged(const OscOutputChangedEvent&);
+        Q_SIGNAL void configurationChanged(const ConfigurationChangedEvent&);
         Q_SIGNAL void closeRundown(const CloseRundownEvent&);
         Q_SIGNAL void activeRundownChanged(const ActiveRundownChangedEvent&);
         Q_SIGNAL void rundownItemSelected(const RundownItemSelectedEvent&);
@@ -118,6 +123,8 @@ class CORE_EXPORT EventManager : public QObject
         Q_SIGNAL void openRundownFromUrlMenu(const OpenRundownFromUrlMenuEvent&);
         Q_SIGNAL void dataChanged(const DataChangedEvent&);
         Q_SIGNAL void mediaChanged(const MediaChangedEvent&);
+        Q_SIGNAL void thumbnailChanged(const ThumbnailChangedEvent&);
+        Q_SIGNAL void thumbnailRequested(const ThumbnailRequestedEvent&);
         Q_SIGNAL void templateChanged(const TemplateChangedEvent&);
         Q_SIGNAL void allowRemoteTriggeringMenu(const AllowRemoteTriggeringMenuEvent&);
         Q_SIGNAL void importPreset(const ImportPresetEvent&);
@@ -179,6 +186,7 @@ class CORE_EXPORT EventManager : public QObject
         void fireAddTemplateDataEvent(const AddTemplateDataEvent&);
         void fireSaveRundownEvent(const SaveRundownEvent&);
         void fireOscOutputChangedEvent(const OscOutputChangedEvent&);
+        void fireConfigurationChangedEvent(const ConfigurationChangedEvent&);
         void fireCloseRundownEvent(const CloseRundownEvent&);
         void fireActiveRundownChangedEvent(const ActiveRundownChangedEvent&);
         void fireRundownItemSelectedEvent(const RundownItemSelectedEvent&);
@@ -191,6 +199,8 @@ class CORE_EXPORT EventManager : public QObject
         void fireOpenRundownFromUrlEvent(const OpenRundownFromUrlEvent&);
         void fireDataChangedEvent(const DataChangedEvent&);
         void fireMediaChangedEvent(const MediaChangedEvent&);
+        void fireThumbnailChangedEvent(const ThumbnailChangedEvent&);
+        void fireThumbnailRequestedEvent(const ThumbnailRequestedEvent&);
         void fireTemplateChangedEvent(const TemplateChangedEvent&);
         void fireAllowRemoteTriggeringMenuEvent(const AllowRemoteTriggeringMenuEvent&);
         void fireImportPresetEvent(const ImportPresetEvent&);
@@ -230,4 +240,11 @@ class CORE_EXPORT EventManager : public QObject
         void fireSaveMenuEvent(const SaveMenuEvent&);
         void fireSaveAsMenuEvent(const SaveAsMenuEvent&);
         void fireInsertRepositoryChangesEvent(const InsertRepositoryChangesEvent&);
+
+    private:
+        // Inspector edits (label, target, device, channel, videolayer and auto play) only concern the selected rundown
+        // item. It gets them directly instead of every rundown item subscribing to the broadcast signals.
+        QPointer<QWidget> selectedRundownItem;
+
+        void sendToSelectedRundownItem(const char* method, QGenericArgument argument);
 };
@@ -0,0 +1,18 @@
+#include "ThumbnailRequestedEvent.h"
+
+#include "Global.h"
+
+ThumbnailRequestedEvent::ThumbnailRequestedEvent(const QString& deviceName, const QString& name)
+    : deviceName(deviceName), name(name)
+{
+}
+
+const QString& ThumbnailRequestedEvent::getDeviceName() const
+{
+    return this->deviceName;
+}
+
+const QString& ThumbnailRequestedEvent::getName() const
+{
+    return this->name;
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "../../Shared.h"
+
+#include <QtCore/QString>
+
+class CORE_EXPORT ThumbnailRequestedEvent
+{
+    public:
+        explicit ThumbnailRequestedEvent(const QString& deviceName, const QString& name);
+
+        const QString& getDeviceName() const;
+        const QString& getName() const;
+
+    private:
+        QString deviceName;
+        QString name;
+};
@@ -0,0 +1,18 @@
+#include "ThumbnailChangedEvent.h"
+
+#include "Global.h"
+
+ThumbnailChangedEvent::ThumbnailChangedEvent(const QString& deviceName, const QStringList& names)
+    : deviceName(deviceName), names(names)
+{
+}
+
+const QString& ThumbnailChangedEvent::getDeviceName() const
+{
+    return this->deviceName;
+}
+
+const QStringList& ThumbnailChangedEvent::getNames() const
+{
+    return this->names;
+}
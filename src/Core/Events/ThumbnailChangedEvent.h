@@ -0,0 +1,19 @@
+#pragma once
+
+#include "../Shared.h"
+
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+
+class CORE_EXPORT ThumbnailChangedEvent
+{
+    public:
+        explicit ThumbnailChangedEvent(const QString& deviceName, const QStringList& names);
+
+        const QString& getDeviceName() const;
+        const QStringList& getNames() const;
+
+    private:
+        QString deviceName;
+        QStringList names;
+};
@@ -0,0 +1,123 @@
+#include "LibraryDiffWorker.h"
+#include "ThumbnailStore.h"
+
+LibraryDiffWorker::LibraryDiffWorker(QObject* parent)
+    : QObject(parent)
+{
+}
+
+void LibraryDiffWorker::process(const QSharedPointer<LibraryDiff>& diff)
+{
+    QTime time;
+    time.start();
+
+    switch (diff->type)
+    {
+        case LibraryDiff::Type::Media:
+            diffMedia(*diff);
+            break;
+        case LibraryDiff::Type::Template:
+            diffTemplate(*diff);
+            break;
+        case LibraryDiff::Type::Data:
+            diffData(*diff);
+            break;
+        case LibraryDiff::Type::Thumbnail:
+            diffThumbnail(*diff);
+            break;
+    }
+
+    diff->elapsed = time.elapsed();
+
+    emit processed(diff);
+}
+
+void LibraryDiffWorker::deleteMissing(LibraryDiff& diff, const QSet<QString>& names)
+{
+    foreach (const LibraryModel& libraryModel, diff.libraryModels)
+    {
+        if (!names.contains(libraryModel.getName()))
+            diff.deleteModels.push_back(libraryModel);
+    }
+}
+
+void LibraryDiffWorker::diffMedia(LibraryDiff& diff)
+{
+    QSet<QString> libraryNames;
+    libraryNames.reserve(diff.libraryModels.count());
+    foreach (const LibraryModel& libraryModel, diff.libraryModels)
+        libraryNames.insert(libraryModel.getName());
+
+    QSet<QString> itemNames;
+    itemNames.reserve(diff.mediaItems.count());
+    foreach (const CasparMedia& mediaItem, diff.mediaItems)
+    {
+        itemNames.insert(mediaItem.getName());
+
+        if (!libraryNames.contains(mediaItem.getName()))
+            diff.insertModels.push_back(LibraryModel(0, mediaItem.getName(), mediaItem.getName(), "", mediaItem.getType(), 0, mediaItem.getTimecode()));
+    }
+
+    deleteMissing(diff, itemNames);
+}
+
+void LibraryDiffWorker::diffTemplate(LibraryDiff& diff)
+{
+    QSet<QString> libraryNames;
+    libraryNames.reserve(diff.libraryModels.count());
+    foreach (const LibraryModel& libraryModel, diff.libraryModels)
+        libraryNames.insert(libraryModel.getName());
+
+    QSet<QString> itemNames;
+    itemNames.reserve(diff.templateItems.count());
+    foreach (const CasparTemplate& templateItem, diff.templateItems)
+    {
+        itemNames.insert(templateItem.getName());
+
+        if (!libraryNames.contains(templateItem.getName()))
+            diff.insertModels.push_back(LibraryModel(0, templateItem.getName(), templateItem.getName(), "", "TEMPLATE", 0, ""));
+    }
+
+    deleteMissing(diff, itemNames);
+}
+
+void LibraryDiffWorker::diffData(LibraryDiff& diff)
+{
+    QSet<QString> libraryNames;
+    libraryNames.reserve(diff.libraryModels.count());
+    foreach (const LibraryModel& libraryModel, diff.libraryModels)
+        libraryNames.insert(libraryModel.getName());
+
+    QSet<QString> itemNames;
+    itemNames.reserve(diff.dataItems.count());
+    foreach (const CasparData& dataItem, diff.dataItems)
+    {
+        itemNames.insert(dataItem.getName());
+
+        if (!libraryNames.contains(dataItem.getName()))
+            diff.insertModels.push_back(LibraryModel(0, dataItem.getName(), dataItem.getName(), "", "DATA", 0, ""));
+    }
+
+    deleteMissing(diff, itemNames);
+}
+
+void LibraryDiffWorker::diffThumbnail(LibraryDiff& diff)
+{
+    // A thumbnail is current when name, timestamp and size all match and its file exists locally.
+    QSet<QString> thumbnailKeys;
+    thumbnailKeys.reserve(diff.thumbnailModels.count());
+    foreach (const ThumbnailModel& thumbnailModel, diff.thumbnailModels)
+    {
+        if (!ThumbnailStore::getInstance().contains(thumbnailModel.getData()))
+            continue;
+
+        thumbnailKeys.insert(thumbnailModel.getName() + '\n' + thumbnailModel.getTimestamp() + '\n' + thumbnailModel.getSize());
+    }
+
+    foreach (const CasparThumbnail& thumbnailItem, diff.thumbnailItems)
+    {
+        if (!thumbnailKeys.contains(thumbnailItem.getName() + '\n' + thumbnailItem.getTimestamp() + '\n' + thumbnailItem.getSize()))
+            diff.processModels.push_back(ThumbnailModel(0, "", thumbnailItem.getTimestamp(), thumbnailItem.getSize(),
+                                                        thumbnailItem.getName(), diff.address));
+    }
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "Shared.h"
+
+#include "Models/CasparData.h"
+#include "Models/CasparMedia.h"
+#include "Models/CasparTemplate.h"
+#include "Models/CasparThumbnail.h"
+#include "Models/LibraryModel.h"
+#include "Models/ThumbnailModel.h"
+
+#include <QtCore/QList>
+#include <QtCore/QMetaType>
+#include <QtCore/QObject>
+#include <QtCore/QSet>
+#include <QtCore/QSharedPointer>
+#include <QtCore/QTime>
+
+// A server listing and the library rows of the same device. The worker fills in the rows to delete and insert,
+// or the thumbnails to retrieve.
+struct LibraryDiff
+{
+    enum class Type
+    {
+        Media,
+        Template,
+        Data,
+        Thumbnail
+    };
+
+    Type type;
+    QString address;
+    QTime time;
+    int elapsed = 0;
+
+    QList<CasparMedia> mediaItems;
+    QList<CasparTemplate> templateItems;
+    QList<CasparData> dataItems;
+    QList<CasparThumbnail> thumbnailItems;
+
+    QList<LibraryModel> libraryModels;
+    QList<ThumbnailModel> thumbnailModels;
+
+    QList<LibraryModel> deleteModels;
+    QList<LibraryModel> insertModels;
+    QList<ThumbnailModel> processModels;
+};
+
+Q_DECLARE_METATYPE(QSharedPointer<LibraryDiff>)
+
+// Lives on its own thread, the diffs of large listings never block the GUI. Database access stays with the caller.
+class CORE_EXPORT LibraryDiffWorker : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit LibraryDiffWorker(QObject* parent = 0);
+
+        Q_SLOT void process(const QSharedPointer<LibraryDiff>& diff);
+
+        Q_SIGNAL void processed(const QSharedPointer<LibraryDiff>&);
+
+    private:
+        void diffMedia(LibraryDiff& diff);
+        void diffTemplate(LibraryDiff& diff);
+        void diffData(LibraryDiff& diff);
+        void diffThumbnail(LibraryDiff& diff);
+
+        void deleteMissing(LibraryDiff& diff, const QSet<QString>& names);
+};
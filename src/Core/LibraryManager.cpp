@@ -2,6 +2,7 @@
 #include "DatabaseManager.h"
 #include "DeviceManager.h"
 #include "EventManager.h"
+#include "ThumbnailStore.h"
 #include "AtemDeviceManager.h"
 #include "TriCasterDeviceManager.h"
 #include "Events/StatusbarEvent.h"
@@ -10,10 +11,14 @@
 #include "Events/Inspector/TemplateChangedEvent.h"
 #include "Models/DeviceModel.h"
 
+#include <QtCore/QDateTime>
+#include <QtCore/QMetaObject>
 #include <QtCore/QSharedPointer>
+#include <QtCore/QtGlobal>
 #include <QtCore/QTime>
 #include <QtCore/QTimer>
 #include <QtCore/QStringList>
+#include <QtCore/QThread>
 
 #include <QtWidgets/QApplication>
 
@@ -22,11 +27,28 @@ Q_GLOBAL_STATIC(LibraryManager, libraryManager)
 LibraryManager::LibraryManager(QObject* parent)
     : QObject(parent)
 {
-    QObject::connect(&this->refreshTimer, SIGNAL(timeout()), this, SLOT(refresh()));
+    qRegisterMetaType<QSharedPointer<LibraryDiff>>();
+
+    this->diffThread = new QThread(this);
+    this->diffThread->setObjectName("Library diff");
+
+    this->diffWorker = new LibraryDiffWorker();
+    this->diffWorker->moveToThread(this->diffThread);
+
+    QObject::connect(this->diffThread, SIGNAL(finished()), this->diffWorker, SLOT(deleteLater()));
+    QObject::connect(this->diffWorker, SIGNAL(processed(const QSharedPointer<LibraryDiff>&)), this, SLOT(diffProcessed(const QSharedPointer<LibraryDiff>&)));
+
+    this->diffThread->start();
+
+    this->staggerTimer.setSingleShot(true);
+
+    QObject::connect(&this->refreshTimer, SIGNAL(timeout()), this, SLOT(autoRefresh()));
+    QObject::connect(&this->staggerTimer, SIGNAL(timeout()), this, SLOT(refreshNextDevice()));
     QObject::connect(&DeviceManager::getInstance(), SIGNAL(deviceRemoved()), this, SLOT(deviceRemoved()));
     QObject::connect(&DeviceManager::getInstance(), SIGNAL(deviceAdded(CasparDevice&)), this, SLOT(deviceAdded(CasparDevice&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(autoRefreshLibrary(const AutoRefreshLibraryEvent&)), this, SLOT(autoRefreshLibrary(const AutoRefreshLibraryEvent&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(refreshLibrary(const RefreshLibraryEvent&)), this, SLOT(refreshLibrary(const RefreshLibraryEvent&)));
+    QObject::connect(&EventManager::getInstance(), SIGNAL(thumbnailRequested(const ThumbnailRequestedEvent&)), this, SLOT(thumbnailRequested(const ThumbnailRequestedEvent&)));
 }
 
 LibraryManager& LibraryManager::getInstance()
@@ -36,6 +58,9 @@ LibraryManager& LibraryManager::getInstance()
 
 void LibraryManager::initialize()
 {
+    // Seed the refresh jitter per client, unseeded every client would pick the same delays.
+    qsrand(static_cast<uint>(QDateTime::currentMSecsSinceEpoch() ^ QCoreApplication::applicationPid()));
+
     EventManager::getInstance().fireRefreshLibraryEvent(RefreshLibraryEvent(0));
     EventManager::getInstance().fireAutoRefreshLibraryEvent(AutoRefreshLibraryEvent((DatabaseManager::getInstance().getConfigurationByName("AutoRefreshLibrary").getValue() == "true") ? true : false,
                                                                                     DatabaseManager::getInstance().getConfigurationByName("RefreshLibraryInterval").getValue().toInt() * 1000));
@@ -43,6 +68,8 @@ void LibraryManager::initialize()
 
 void LibraryManager::uninitialize()
 {
+    this->diffThread->quit();
+    this->diffThread->wait();
 }
 
 void LibraryManager::refreshLibrary(const RefreshLibraryEvent& event)
@@ -64,20 +91,41 @@ void LibraryManager::autoRefreshLibrary(const AutoRefreshLibraryEvent& event)
     }
 }
 
-void LibraryManager::refresh()
+bool LibraryManager::refreshDevices()
 {
-    // Clear out all thumbnail workers.
-    this->thumbnailWorkers.clear();
-
     DeviceManager::getInstance().refresh();
     AtemDeviceManager::getInstance().refresh();
     TriCasterDeviceManager::getInstance().refresh();
 
+    this->refreshTimer.setInterval(DatabaseManager::getInstance().getConfigurationByName("RefreshLibraryInterval").getValue().toInt() * 1000);
+
     if (DeviceManager::getInstance().getDeviceCount() == 0)
-        return;
+        return false;
 
     EventManager::getInstance().fireStatusbarEvent(StatusbarEvent("Refreshing library..."));
 
+    return true;
+}
+
+void LibraryManager::refreshDeviceLibrary(CasparDevice& device)
+{
+    device.refreshServerVersion();
+    device.refreshChannels();
+    device.refreshMedia();
+    device.refreshTemplate();
+    device.refreshData();
+    device.refreshThumbnail();
+}
+
+void LibraryManager::refresh()
+{
+    // A manual refresh hits every device right away and resynchronizes the library even if nothing changed.
+    this->staggerTimer.stop();
+    this->staggeredDevices.clear();
+
+    if (!refreshDevices())
+        return;
+
     // Only refresh library for all devices.
     foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
     {
@@ -87,25 +135,104 @@ void LibraryManager::refresh()
         const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(model.getName());
         if (device != NULL && device->isConnected())
         {
-            device->refreshServerVersion();
-            device->refreshChannels();
-            device->refreshMedia();
-            device->refreshTemplate();
-            device->refreshData();
-            device->refreshThumbnail();
+            device->resetListingHashes();
+            refreshDeviceLibrary(*device);
         }
     }
+}
 
-    this->refreshTimer.setInterval(DatabaseManager::getInstance().getConfigurationByName("RefreshLibraryInterval").getValue().toInt() * 1000);
+void LibraryManager::autoRefresh()
+{
+    this->staggerTimer.stop();
+    this->staggeredDevices.clear();
+
+    if (!refreshDevices())
+        return;
+
+    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+    {
+        if (model.getShadow() == "Yes")
+            continue;
+
+        this->staggeredDevices.enqueue(model.getName());
+    }
+
+    if (this->staggeredDevices.isEmpty())
+        return;
+
+    // Spread the devices across the interval so that large listings do not all arrive at the same time.
+    this->staggerInterval = this->refreshTimer.interval() / this->staggeredDevices.count();
+
+    refreshNextDevice();
+}
+
+void LibraryManager::refreshNextDevice()
+{
+    if (this->staggeredDevices.isEmpty())
+        return;
+
+    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->staggeredDevices.dequeue());
+    if (device != NULL && device->isConnected())
+        refreshDeviceLibrary(*device);
+
+    if (this->staggeredDevices.isEmpty())
+        return;
+
+    // Jitter within the second half of the slot, the last device is still refreshed before the next interval.
+    int jitter = this->staggerInterval / 2;
+    this->staggerTimer.start(this->staggerInterval - jitter + qrand() % (jitter + 1));
 }
 
 void LibraryManager::deviceRemoved()
 {
+    QStringList addresses;
+    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+        addresses.push_back(model.getAddress());
+
+    foreach (const QString& address, this->thumbnailWorkers.keys())
+    {
+        if (!addresses.contains(address))
+            this->thumbnailWorkers.remove(address);
+    }
+
     EventManager::getInstance().fireMediaChangedEvent(MediaChangedEvent());
     EventManager::getInstance().fireTemplateChangedEvent(TemplateChangedEvent());
     EventManager::getInstance().fireDataChangedEvent(DataChangedEvent());
 }
 
+void LibraryManager::thumbnailRequested(const ThumbnailRequestedEvent& event)
+{
+    const QSharedPointer<DeviceModel> model = DeviceManager::getInstance().getDeviceModelByName(event.getDeviceName());
+    if (model == NULL)
+        return;
+
+    if (this->thumbnailWorkers.contains(model->getAddress()) && this->thumbnailWorkers.value(model->getAddress())->prioritize(event.getName()))
+        return;
+
+    // Not queued. Only a stored thumbnail whose file is missing or broken is retrieved again, an unchanged
+    // listing is never diffed again so it would stay blank.
+    const ThumbnailModel thumbnailModel = DatabaseManager::getInstance().getThumbnailByNameAndDeviceName(event.getName(), event.getDeviceName());
+    if (thumbnailModel.getData().isEmpty() || ThumbnailStore::getInstance().contains(thumbnailModel.getData()))
+        return;
+
+    bool storeThumbnailsInDatabase = (DatabaseManager::getInstance().getConfigurationByName("StoreThumbnailsInDatabase").getValue() == "true") ? true : false;
+    if (!storeThumbnailsInDatabase)
+        return;
+
+    const ThumbnailModel retrieveModel(0, "", thumbnailModel.getTimestamp(), thumbnailModel.getSize(), event.getName(), model->getAddress());
+    if (this->thumbnailWorkers.contains(model->getAddress()))
+    {
+        this->thumbnailWorkers.value(model->getAddress())->retrieve(retrieveModel);
+    }
+    else
+    {
+        QSharedPointer<ThumbnailWorker> thumbnailWorker(new ThumbnailWorker(QList<ThumbnailModel>() << retrieveModel));
+        thumbnailWorker->start();
+
+        this->thumbnailWorkers.insert(model->getAddress(), thumbnailWorker);
+    }
+}
+
 void LibraryManager::deviceAdded(CasparDevice& device)
 {
     QObject::connect(&device, SIGNAL(versionChanged(const QString&, CasparDevice&)), this, SLOT(versionChanged(const QString&, CasparDevice&)));
@@ -141,181 +268,154 @@ void LibraryManager::connectionStateChanged(CasparDevice& device)
         if (model == NULL || model->getShadow() == "Yes")
             return;
 
-        device.refreshServerVersion();
-        device.refreshChannels();
-        device.refreshMedia();
-        device.refreshTemplate();
-        device.refreshData();
-        device.refreshThumbnail();
+        refreshDeviceLibrary(device);
     }
 }
 
 void LibraryManager::mediaChanged(const QList<CasparMedia>& mediaItems, CasparDevice& device)
 {
-    QTime time;
-    time.start();
-
-    QList<LibraryModel> insertModels;
-    QList<LibraryModel> deleteModels;
-    QList<LibraryModel> libraryModels = DatabaseManager::getInstance().getLibraryMediaByDeviceAddress(device.getAddress());
-
-    // Find library items to delete.
-    foreach (const LibraryModel& libraryModel, libraryModels)
-    {
-        bool found = false;
-        foreach (CasparMedia mediaItem, mediaItems)
-        {
-            if (mediaItem.getName() == libraryModel.getName())
-                found = true;
-        }
-
-        if (!found)
-            deleteModels.push_back(libraryModel);
-    }
+    QSharedPointer<LibraryDiff> diff(new LibraryDiff());
+    diff->type = LibraryDiff::Type::Media;
+    diff->address = device.getAddress();
+    diff->mediaItems = mediaItems;
 
-    // Find library items to insert.
-    foreach (CasparMedia mediaItem, mediaItems)
-    {
-        bool found = false;
-        foreach (const LibraryModel& libraryModel, libraryModels)
-        {
-            if (libraryModel.getName() == mediaItem.getName())
-                found = true;
-        }
-
-        if (!found)
-            insertModels.push_back(LibraryModel(0, mediaItem.getName(), mediaItem.getName(), "", mediaItem.getType(), 0, mediaItem.getTimecode()));
-    }
-
-    if (deleteModels.count() > 0 || insertModels.count() > 0)
-    {
-        DatabaseManager::getInstance().updateLibraryMedia(device.getAddress(), deleteModels, insertModels);
-        EventManager::getInstance().fireMediaChangedEvent(MediaChangedEvent());
-    }
-
-    qDebug("LibraryManager::mediaChanged %d msec", time.elapsed());
+    startDiff(diff);
 }
 
 void LibraryManager::templateChanged(const QList<CasparTemplate>& templateItems, CasparDevice& device)
 {
-    QTime time;
-    time.start();
-
-    QList<LibraryModel> insertModels;
-    QList<LibraryModel> deleteModels;
-    QList<LibraryModel> libraryModels = DatabaseManager::getInstance().getLibraryTemplateByDeviceAddress(device.getAddress());
-
-    // Find library items to delete.
-    foreach (const LibraryModel& libraryModel, libraryModels)
-    {
-        bool found = false;
-        foreach (CasparTemplate templateItem, templateItems)
-        {
-            if (templateItem.getName() == libraryModel.getName())
-                found = true;
-        }
-
-        if (!found)
-            deleteModels.push_back(libraryModel);
-    }
-
-    // Find library items to insert.
-    foreach (CasparTemplate templateItem, templateItems)
-    {
-        bool found = false;
-        foreach (const LibraryModel& libraryModel, libraryModels)
-        {
-            if (libraryModel.getName() == templateItem.getName())
-                found = true;
-        }
+    QSharedPointer<LibraryDiff> diff(new LibraryDiff());
+    diff->type = LibraryDiff::Type::Template;
+    diff->address = device.getAddress();
+    diff->templateItems = templateItems;
 
-        if (!found)
-            insertModels.push_back(LibraryModel(0, templateItem.getName(), templateItem.getName(), "", "TEMPLATE", 0, ""));
-    }
+    startDiff(diff);
+}
 
-    if (deleteModels.count() > 0 || insertModels.count() > 0)
-    {
-        DatabaseManager::getInstance().updateLibraryTemplate(device.getAddress(), deleteModels, insertModels);
-        EventManager::getInstance().fireTemplateChangedEvent(TemplateChangedEvent());
-    }
+void LibraryManager::dataChanged(const QList<CasparData>& dataItems, CasparDevice& device)
+{
+    QSharedPointer<LibraryDiff> diff(new LibraryDiff());
+    diff->type = LibraryDiff::Type::Data;
+    diff->address = device.getAddress();
+    diff->dataItems = dataItems;
 
-    qDebug("LibraryManager::templateChanged %d msec", time.elapsed());
+    startDiff(diff);
 }
 
-void LibraryManager::dataChanged(const QList<CasparData>& dataItems, CasparDevice& device)
+void LibraryManager::thumbnailChanged(const QList<CasparThumbnail>& thumbnailItems, CasparDevice& device)
 {
-    QTime time;
-    time.start();
+    QSharedPointer<LibraryDiff> diff(new LibraryDiff());
+    diff->type = LibraryDiff::Type::Thumbnail;
+    diff->address = device.getAddress();
+    diff->thumbnailItems = thumbnailItems;
 
-    QList<LibraryModel> insertModels;
-    QList<LibraryModel> deleteModels;
-    QList<LibraryModel> libraryModels = DatabaseManager::getInstance().getLibraryDataByDeviceAddress(device.getAddress());
+    startDiff(diff);
+}
 
-    // Find library items to delete.
-    foreach (const LibraryModel& libraryModel, libraryModels)
+void LibraryManager::startDiff(const QSharedPointer<LibraryDiff>& diff)
+{
+    // One diff per device and listing at a time, the next one has to see the rows written by the previous one.
+    // Only the latest listing that arrives meanwhile is kept.
+    QString key = QString("%1 %2").arg(static_cast<int>(diff->type)).arg(diff->address);
+    if (this->runningDiffs.contains(key))
     {
-        bool found = false;
-        foreach (CasparData dataItem, dataItems)
-        {
-            if (dataItem.getName() == libraryModel.getName())
-                found = true;
-        }
-
-        if (!found)
-            deleteModels.push_back(libraryModel);
+        this->pendingDiffs.insert(key, diff);
+        return;
     }
 
-    // Find library items to insert.
-    foreach (CasparData dataItem, dataItems)
-    {
-        bool found = false;
-        foreach (const LibraryModel& libraryModel, libraryModels)
-        {
-            if (libraryModel.getName() == dataItem.getName())
-                found = true;
-        }
+    this->runningDiffs.insert(key);
 
-        if (!found)
-            insertModels.push_back(LibraryModel(0, dataItem.getName(), dataItem.getName(), "", "DATA", 0, ""));
-    }
+    diff->time.start();
 
-    if (deleteModels.count() > 0 || insertModels.count() > 0)
+    // The database is only accessed from this thread.
+    switch (diff->type)
     {
-        DatabaseManager::getInstance().updateLibraryData(device.getAddress(), deleteModels, insertModels);
-        EventManager::getInstance().fireDataChangedEvent(DataChangedEvent());
+        case LibraryDiff::Type::Media:
+            diff->libraryModels = DatabaseManager::getInstance().getLibraryMediaByDeviceAddress(diff->address);
+            break;
+        case LibraryDiff::Type::Template:
+            diff->libraryModels = DatabaseManager::getInstance().getLibraryTemplateByDeviceAddress(diff->address);
+            break;
+        case LibraryDiff::Type::Data:
+            diff->libraryModels = DatabaseManager::getInstance().getLibraryDataByDeviceAddress(diff->address);
+            break;
+        case LibraryDiff::Type::Thumbnail:
+            diff->thumbnailModels = DatabaseManager::getInstance().getThumbnailByDeviceAddress(diff->address);
+            break;
     }
 
-    qDebug("LibraryManager::dataChanged %d msec", time.elapsed());
+    QMetaObject::invokeMethod(this->diffWorker, "process", Qt::QueuedConnection, Q_ARG(QSharedPointer<LibraryDiff>, diff));
 }
 
-void LibraryManager::thumbnailChanged(const QList<CasparThumbnail>& thumbnailItems, CasparDevice& device)
+void LibraryManager::diffProcessed(const QSharedPointer<LibraryDiff>& diff)
 {
-    QList<ThumbnailModel> processModels;
-    QList<ThumbnailModel> thumbnailModels = DatabaseManager::getInstance().getThumbnailByDeviceAddress(device.getAddress());
+    QString key = QString("%1 %2").arg(static_cast<int>(diff->type)).arg(diff->address);
+    this->runningDiffs.remove(key);
 
-    // Find thumbnail items to process.
-    foreach (CasparThumbnail thumbnailItem, thumbnailItems)
+    // The device might have been removed while the diff was running.
+    if (DeviceManager::getInstance().getDeviceModelByAddress(diff->address) != NULL)
     {
-        bool found = false;
-        foreach (const ThumbnailModel& thumbnailModel, thumbnailModels)
+        switch (diff->type)
         {
-            if (thumbnailModel.getName() == thumbnailItem.getName() &&
-                thumbnailModel.getTimestamp() == thumbnailItem.getTimestamp() &&
-                thumbnailModel.getSize() == thumbnailItem.getSize())
-                found = true;
+            case LibraryDiff::Type::Media:
+            {
+                if (diff->deleteModels.count() > 0 || diff->insertModels.count() > 0)
+                {
+                    DatabaseManager::getInstance().updateLibraryMedia(diff->address, diff->deleteModels, diff->insertModels);
+                    EventManager::getInstance().fireMediaChangedEvent(MediaChangedEvent());
+                }
+
+                qDebug("LibraryManager::mediaChanged %d msec (diff %d msec)", diff->time.elapsed(), diff->elapsed);
+
+                break;
+            }
+            case LibraryDiff::Type::Template:
+            {
+                if (diff->deleteModels.count() > 0 || diff->insertModels.count() > 0)
+                {
+                    DatabaseManager::getInstance().updateLibraryTemplate(diff->address, diff->deleteModels, diff->insertModels);
+                    EventManager::getInstance().fireTemplateChangedEvent(TemplateChangedEvent());
+                }
+
+                qDebug("LibraryManager::templateChanged %d msec (diff %d msec)", diff->time.elapsed(), diff->elapsed);
+
+                break;
+            }
+            case LibraryDiff::Type::Data:
+            {
+                if (diff->deleteModels.count() > 0 || diff->insertModels.count() > 0)
+                {
+                    DatabaseManager::getInstance().updateLibraryData(diff->address, diff->deleteModels, diff->insertModels);
+                    EventManager::getInstance().fireDataChangedEvent(DataChangedEvent());
+                }
+
+                qDebug("LibraryManager::dataChanged %d msec (diff %d msec)", diff->time.elapsed(), diff->elapsed);
+
+                break;
+            }
+            case LibraryDiff::Type::Thumbnail:
+            {
+                bool storeThumbnailsInDatabase = (DatabaseManager::getInstance().getConfigurationByName("StoreThumbnailsInDatabase").getValue() == "true") ? true : false;
+                if (storeThumbnailsInDatabase)
+                {
+                    if (this->thumbnailWorkers.contains(diff->address))
+                        this->thumbnailWorkers.value(diff->address)->stop();
+
+                    QSharedPointer<ThumbnailWorker> thumbnailWorker(new ThumbnailWorker(diff->processModels));
+                    thumbnailWorker->start();
+
+                    // Replaces the previous worker of the device. Workers are no longer cleared on each refresh, a listing
+                    // that did not change is not notified again and would leave its remaining thumbnails unprocessed.
+                    this->thumbnailWorkers.insert(diff->address, thumbnailWorker);
+                }
+
+                qDebug("LibraryManager::thumbnailChanged %d msec (diff %d msec)", diff->time.elapsed(), diff->elapsed);
+
+                break;
+            }
         }
-
-        if (!found)
-            processModels.push_back(ThumbnailModel(0, "", thumbnailItem.getTimestamp(), thumbnailItem.getSize(),
-                                                   thumbnailItem.getName(), device.getAddress()));
     }
 
-    bool storeThumbnailsInDatabase = (DatabaseManager::getInstance().getConfigurationByName("StoreThumbnailsInDatabase").getValue() == "true") ? true : false;
-    if (storeThumbnailsInDatabase)
-    {
-        QSharedPointer<ThumbnailWorker> thumbnailWorker(new ThumbnailWorker(processModels));
-        thumbnailWorker->start();
-
-        this->thumbnailWorkers.push_back(thumbnailWorker);
-    }
+    if (this->pendingDiffs.contains(key))
+        startDiff(this->pendingDiffs.take(key));
 }
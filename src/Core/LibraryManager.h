@@ -6,18 +6,25 @@
 
 #include "CasparDevice.h"
 
+#include "LibraryDiffWorker.h"
 #include "ThumbnailWorker.h"
 #include "Events/Library/RefreshLibraryEvent.h"
 #include "Events/Library/AutoRefreshLibraryEvent.h"
+#include "Events/Library/ThumbnailRequestedEvent.h"
 #include "Models/CasparData.h"
 #include "Models/CasparMedia.h"
 #include "Models/CasparTemplate.h"
 #include "Models/CasparThumbnail.h"
 
+#include <QtCore/QMap>
 #include <QtCore/QObject>
+#include <QtCore/QQueue>
+#include <QtCore/QSet>
 #include <QtCore/QSharedPointer>
 #include <QtCore/QTimer>
 
+class QThread;
+
 class CORE_EXPORT LibraryManager : public QObject
 {
     Q_OBJECT
@@ -32,9 +39,24 @@ class CORE_EXPORT LibraryManager : public QObject
 
     private:
         QTimer refreshTimer;
-        QList<QSharedPointer<ThumbnailWorker>> thumbnailWorkers;
+        QTimer staggerTimer;
+        int staggerInterval = 0;
+        QQueue<QString> staggeredDevices;
+        QMap<QString, QSharedPointer<ThumbnailWorker>> thumbnailWorkers;
+
+        QThread* diffThread = nullptr;
+        LibraryDiffWorker* diffWorker = nullptr;
+        QSet<QString> runningDiffs;
+        QMap<QString, QSharedPointer<LibraryDiff>> pendingDiffs;
+
+        void startDiff(const QSharedPointer<LibraryDiff>& diff);
+
+        bool refreshDevices();
+        void refreshDeviceLibrary(CasparDevice& device);
 
         Q_SLOT void refresh();
+        Q_SLOT void autoRefresh();
+        Q_SLOT void refreshNextDevice();
         Q_SLOT void deviceRemoved();
         Q_SLOT void deviceAdded(CasparDevice&);
         Q_SLOT void versionChanged(const QString&, CasparDevice&);
@@ -44,7 +66,9 @@ class CORE_EXPORT LibraryManager : public QObject
         Q_SLOT void templateChanged(const QList<CasparTemplate>&, CasparDevice&);
         Q_SLOT void dataChanged(const QList<CasparData>&, CasparDevice&);
         Q_SLOT void thumbnailChanged(const QList<CasparThumbnail>&, CasparDevice&);
+        Q_SLOT void diffProcessed(const QSharedPointer<LibraryDiff>&);
 
         Q_SLOT void refreshLibrary(const RefreshLibraryEvent&);
         Q_SLOT void autoRefreshLibrary(const AutoRefreshLibraryEvent&);
+        Q_SLOT void thumbnailRequested(const ThumbnailRequestedEvent&);
 };
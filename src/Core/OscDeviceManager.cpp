@@ -1,8 +1,14 @@
 #include "OscDeviceManager.h"
+#include "OscSubscription.h"
 #include "DatabaseManager.h"
+#include "DeviceManager.h"
 
+#include <QtCore/QPointer>
 #include <QtCore/QSharedPointer>
 
+#include <QtGui/QGuiApplication>
+#include <QtGui/QScreen>
+
 Q_GLOBAL_STATIC(OscDeviceManager, oscDeviceManager)
 
 OscDeviceManager::OscDeviceManager()
@@ -16,16 +22,30 @@ OscDeviceManager& OscDeviceManager::getInstance()
 
 void OscDeviceManager::initialize()
 {
-    this->oscSender = QSharedPointer<OscSender>();
+    this->oscSender = QSharedPointer<OscSender>(new OscSender());
 
     QString oscPort = DatabaseManager::getInstance().getConfigurationByName("OscPort").getValue();
     this->oscListener = QSharedPointer<OscListener>(new OscListener("0.0.0.0", (oscPort.isEmpty() == true) ? Osc::DEFAULT_PORT : oscPort.toInt()));
+    QObject::connect(this->oscListener.data(), SIGNAL(messageReceived(const QString&, const QList<QVariant>&)),
+                     this, SLOT(messageReceived(const QString&, const QList<QVariant>&)));
+    QObject::connect(this->oscListener.data(), SIGNAL(controlReceived(const QString&, const QList<QVariant>&, const QElapsedTimer&)),
+                     this, SLOT(controlReceived(const QString&, const QList<QVariant>&, const QElapsedTimer&)));
+
+    // Deliver OSC updates once per display refresh unless an interval is configured.
+    int oscInputInterval = DatabaseManager::getInstance().getConfigurationByName("OscInputInterval").getValue().toInt();
+    if (oscInputInterval <= 0 && QGuiApplication::primaryScreen() != NULL && QGuiApplication::primaryScreen()->refreshRate() > 0)
+        oscInputInterval = qRound(1000 / QGuiApplication::primaryScreen()->refreshRate());
+
+    if (oscInputInterval > 0)
+        this->oscListener->setFlushInterval(oscInputInterval);
+
     if (DatabaseManager::getInstance().getConfigurationByName("EnableOscInput").getValue() == "true")
         this->oscListener->start();
 }
 
 void OscDeviceManager::uninitialize()
 {
+    this->oscSender.clear();
 }
 
 const QSharedPointer<OscSender> OscDeviceManager::getOscSender() const
@@ -37,3 +57,94 @@ const QSharedPointer<OscListener> OscDeviceManager::getOscListener() const
 {
     return this->oscListener;
 }
+
+void OscDeviceManager::addSubscription(OscSubscription* subscription)
+{
+    this->subscriptions.insert(subscription->getPath(), subscription);
+}
+
+void OscDeviceManager::removeSubscription(OscSubscription* subscription)
+{
+    this->subscriptions.remove(subscription->getPath(), subscription);
+}
+
+qint64 OscDeviceManager::getLastControlLatency() const
+{
+    return this->lastControlLatency;
+}
+
+qint64 OscDeviceManager::getMaxControlLatency() const
+{
+    return this->maxControlLatency;
+}
+
+void OscDeviceManager::controlReceived(const QString& path, const QList<QVariant>& arguments, const QElapsedTimer& timer)
+{
+    // Everything the handlers send goes out in one write as soon as they return, instead of on the next event loop
+    // turn. Commands delayed by the item itself are not included in the measurement.
+    DeviceManager::getInstance().beginBatch();
+    messageReceived(path, arguments);
+    DeviceManager::getInstance().endBatch();
+
+    this->lastControlLatency = timer.nsecsElapsed() / 1000;
+    this->maxControlLatency = qMax(this->maxControlLatency, this->lastControlLatency);
+
+    qDebug("Received OSC control message %s, dispatched after %lld us", qPrintable(path), this->lastControlLatency);
+}
+
+PlaybackState* OscDeviceManager::getPlaybackState(const QString& address, int channel, int videolayer)
+{
+    const QString key = QString("%1/channel/%2/stage/layer/%3").arg(address).arg(channel).arg(videolayer);
+
+    PlaybackState* state = this->playbackStates.value(key);
+    if (state == NULL)
+    {
+        state = new PlaybackState(this);
+        this->playbackStates.insert(key, state);
+    }
+
+    return state;
+}
+
+void OscDeviceManager::messageReceived(const QString& path, const QList<QVariant>& arguments)
+{
+    // Layer status, i.e. <address>/channel/<channel>/stage/layer/<layer>/<property>, updates the state table.
+    int layerPosition = path.indexOf("/stage/layer/");
+    if (layerPosition > 0)
+    {
+        int propertyPosition = path.indexOf('/', layerPosition + 13);
+        if (propertyPosition > 0)
+        {
+            const QString key = path.left(propertyPosition);
+
+            PlaybackState* state = this->playbackStates.value(key);
+            if (state != NULL && !state->hasObservers())
+            {
+                // Every widget moved on to another server, channel or layer.
+                this->playbackStates.remove(key);
+                state->deleteLater();
+            }
+            else if (state != NULL)
+            {
+                state->update(path.mid(propertyPosition + 1), arguments);
+            }
+        }
+    }
+
+    // A subscription matches when the received path ends with it, i.e. the server address followed by the address
+    // pattern, or just the address pattern. Look up the full path and every suffix starting at a slash instead of
+    // testing every subscription.
+    QList<QPointer<OscSubscription>> matches;
+    for (int position = 0; position >= 0 && position < path.length(); position = path.indexOf('/', position + 1))
+    {
+        foreach (OscSubscription* subscription, this->subscriptions.values((position == 0) ? path : path.mid(position)))
+            matches.push_back(subscription);
+    }
+
+    // Handlers may delete or create subscriptions.
+    foreach (const QPointer<OscSubscription>& subscription, matches)
+    {
+        if (!subscription.isNull())
+            subscription->dispatch(arguments);
+    }
+}
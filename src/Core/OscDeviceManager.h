@@ -4,9 +4,18 @@
 
 #include "OscSender.h"
 #include "OscListener.h"
+#include "PlaybackState.h"
 
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QMultiHash>
 #include <QtCore/QObject>
 #include <QtCore/QSharedPointer>
+#include <QtCore/QString>
+#include <QtCore/QVariant>
+
+class OscSubscription;
 
 class CORE_EXPORT OscDeviceManager : public QObject
 {
@@ -23,8 +32,27 @@ class CORE_EXPORT OscDeviceManager : public QObject
         const QSharedPointer<OscSender> getOscSender() const;
         const QSharedPointer<OscListener> getOscListener() const;
 
+        void addSubscription(OscSubscription* subscription);
+        void removeSubscription(OscSubscription* subscription);
+
+        // Shared by every item that targets the layer, the entry is created on first use.
+        PlaybackState* getPlaybackState(const QString& address, int channel, int videolayer);
+
+        // Time from receiving a /control message until its AMCP commands are handed to the connection, in
+        // microseconds.
+        qint64 getLastControlLatency() const;
+        qint64 getMaxControlLatency() const;
+
     private:
         QSharedPointer<OscSender> oscSender;
         QSharedPointer<OscListener> oscListener;
-};
 
+        QMultiHash<QString, OscSubscription*> subscriptions;
+        QHash<QString, PlaybackState*> playbackStates;
+
+        qint64 lastControlLatency = 0;
+        qint64 maxControlLatency = 0;
+
+        Q_SLOT void messageReceived(const QString&, const QList<QVariant>&);
+        Q_SLOT void controlReceived(const QString&, const QList<QVariant>&, const QElapsedTimer&);
+};
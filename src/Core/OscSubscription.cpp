@@ -1,6 +1,5 @@
 #include "OscSubscription.h"
 #include "OscDeviceManager.h"
-#include "OscWebSocketManager.h"
 
 #include <QtCore/QDebug>
 #include <QtCore/QSharedPointer>
@@ -8,19 +7,23 @@
 OscSubscription::OscSubscription(const QString& path, QObject *parent)
     : QObject(parent),
       path(path)
-{  
-    QObject::connect(OscDeviceManager::getInstance().getOscListener().data(), SIGNAL(messageReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(messageReceived(const QString&, const QList<QVariant>&)));
-    QObject::connect(OscWebSocketManager::getInstance().getOscWebSocketListener().data(), SIGNAL(messageReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(messageReceived(const QString&, const QList<QVariant>&)));
+{
+    OscDeviceManager::getInstance().addSubscription(this);
+}
+
+OscSubscription::~OscSubscription()
+{
+    OscDeviceManager::getInstance().removeSubscription(this);
+}
+
+const QString& OscSubscription::getPath() const
+{
+    return this->path;
 }
 
-void OscSubscription::messageReceived(const QString& pattern, const QList<QVariant>& arguments)
+void OscSubscription::dispatch(const QList<QVariant>& arguments)
 {
-    if (pattern.endsWith(this->path))
-    {
-        //qDebug("Found a subscriber: %s:%s", qPrintable(this->parent()), qPrintable(this->path));
+    //qDebug("Found a subscriber: %s:%s", qPrintable(this->parent()), qPrintable(this->path));
 
-        emit subscriptionReceived(this->path, arguments);
-    }
+    emit subscriptionReceived(this->path, arguments);
 }
@@ -14,11 +14,14 @@ class CORE_EXPORT OscSubscription : public QObject
 
     public:
         explicit OscSubscription(const QString& path, QObject* parent = 0);
+        ~OscSubscription();
+
+        const QString& getPath() const;
+
+        void dispatch(const QList<QVariant>& arguments);
 
         Q_SIGNAL void subscriptionReceived(const QString&, const QList<QVariant>&);
 
     private:
         QString path;
-
-        Q_SLOT void messageReceived(const QString&, const QList<QVariant>&);
 };
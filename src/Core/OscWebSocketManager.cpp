@@ -1,4 +1,5 @@
 #include "OscWebSocketManager.h"
+#include "OscDeviceManager.h"
 #include "DatabaseManager.h"
 
 #include <QtCore/QSharedPointer>
@@ -18,6 +19,13 @@ void OscWebSocketManager::initialize()
 {
     QString oscWebSocketPort = DatabaseManager::getInstance().getConfigurationByName("OscWebSocketPort").getValue();
     this->oscWebSocketListener = QSharedPointer<OscWebSocketListener>(new OscWebSocketListener(this));
+    QObject::connect(this->oscWebSocketListener.data(), SIGNAL(messageReceived(const QString&, const QList<QVariant>&)),
+                     &OscDeviceManager::getInstance(), SLOT(messageReceived(const QString&, const QList<QVariant>&)));
+
+    // Mirror the server state to WebSocket clients. The listener delivers it already coalesced per address.
+    QObject::connect(OscDeviceManager::getInstance().getOscListener().data(), SIGNAL(messageReceived(const QString&, const QList<QVariant>&)),
+                     this->oscWebSocketListener.data(), SLOT(publish(const QString&, const QList<QVariant>&)));
+
     if (DatabaseManager::getInstance().getConfigurationByName("EnableOscInput").getValue() == "true")
         this->oscWebSocketListener->start((oscWebSocketPort.isEmpty() == true) ? Osc::DEFAULT_WEBSOCKET_PORT : oscWebSocketPort.toInt());
 }
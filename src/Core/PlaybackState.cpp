@@ -0,0 +1,115 @@
+#include "PlaybackState.h"
+
+#include <QtCore/QMetaObject>
+
+// The server sends the file state of a playing or paused layer every frame, a state that has not been updated for
+// longer than this belongs to a layer that was cleared or stopped.
+static const int MAX_AGE = 250;
+
+PlaybackState::PlaybackState(QObject* parent)
+    : QObject(parent)
+{
+}
+
+const OscFileModel& PlaybackState::getFile() const
+{
+    return this->file;
+}
+
+bool PlaybackState::isPaused() const
+{
+    return this->paused;
+}
+
+bool PlaybackState::isLoop() const
+{
+    return this->loop;
+}
+
+bool PlaybackState::hasObservers() const
+{
+    return receivers(SIGNAL(stateChanged())) > 0;
+}
+
+bool PlaybackState::isCurrent() const
+{
+    return this->lastUpdate.isValid() && this->lastUpdate.elapsed() <= MAX_AGE;
+}
+
+void PlaybackState::update(const QString& property, const QList<QVariant>& arguments)
+{
+    if (arguments.isEmpty())
+        return;
+
+    this->lastUpdate.start();
+
+    if (property == "file/time" && arguments.count() > 1)
+    {
+        // The display is frame based, the frame message that comes with it decides whether anything changed.
+        this->file.setTime(arguments.at(0).toDouble());
+        this->file.setTotalTime(arguments.at(1).toDouble());
+    }
+    else if (property == "file/frame" && arguments.count() > 1)
+    {
+        int frame = arguments.at(0).toInt();
+        int totalFrames = arguments.at(1).toInt();
+        if (frame != this->file.getFrame() || totalFrames != this->file.getTotalFrames())
+        {
+            this->file.setFrame(frame);
+            this->file.setTotalFrames(totalFrames);
+            markChanged();
+        }
+    }
+    else if (property == "file/fps")
+    {
+        double fps = arguments.at(0).toDouble();
+        if (fps != this->file.getFramesPerSecond())
+        {
+            this->file.setFramesPerSecond(fps);
+            markChanged();
+        }
+    }
+    else if (property == "file/path")
+    {
+        QString path = arguments.at(0).toString();
+        if (path != this->file.getPath())
+        {
+            this->file.setPath(path);
+            markChanged();
+        }
+    }
+    else if (property == "paused")
+    {
+        bool paused = arguments.at(0).toBool();
+        if (paused != this->paused)
+        {
+            this->paused = paused;
+            markChanged();
+        }
+    }
+    else if (property == "loop")
+    {
+        bool loop = arguments.at(0).toBool();
+        if (loop != this->loop)
+        {
+            this->loop = loop;
+            markChanged();
+        }
+    }
+}
+
+void PlaybackState::markChanged()
+{
+    if (this->notifyScheduled)
+        return;
+
+    this->notifyScheduled = true;
+    QMetaObject::invokeMethod(this, "notify", Qt::QueuedConnection);
+}
+
+void PlaybackState::notify()
+{
+    this->notifyScheduled = false;
+
+    emit stateChanged();
+}
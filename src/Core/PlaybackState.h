@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Shared.h"
+
+#include "Models/OscFileModel.h"
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QList>
+#include <QtCore/QObject>
+#include <QtCore/QString>
+#include <QtCore/QVariant>
+
+// Last known playback state of one server, channel and layer, fed from OSC. Observers are notified at most once per
+// event loop turn, and only when something visible changed.
+class CORE_EXPORT PlaybackState : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit PlaybackState(QObject* parent = 0);
+
+        const OscFileModel& getFile() const;
+        bool isPaused() const;
+        bool isLoop() const;
+        bool hasObservers() const;
+        bool isCurrent() const;
+
+        void update(const QString& property, const QList<QVariant>& arguments);
+
+        Q_SIGNAL void stateChanged();
+
+    private:
+        OscFileModel file;
+        bool paused = false;
+        bool loop = false;
+        bool notifyScheduled = false;
+        QElapsedTimer lastUpdate;
+
+        void markChanged();
+
+        Q_SLOT void notify();
+};
@@ -0,0 +1,6 @@
+CREATE INDEX IX_Configuration_Name ON Configuration (Name(191));
+CREATE INDEX IX_Device_Name ON Device (Name(191));
+CREATE INDEX IX_Device_Address ON Device (Address(191));
+CREATE INDEX IX_Library_DeviceId_TypeId ON Library (DeviceId, TypeId);
+CREATE INDEX IX_Library_Name ON Library (Name(191));
+CREATE INDEX IX_Library_ThumbnailId ON Library (ThumbnailId);
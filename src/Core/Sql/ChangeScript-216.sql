@@ -0,0 +1,2 @@
+DELETE FROM Thumbnail;
+UPDATE Library SET ThumbnailId = 0;
@@ -33,6 +33,13 @@ CREATE TABLE TriCasterSource (Id INTEGER PRIMARY KEY AUTO_INCREMENT, Name TEXT,
 CREATE TABLE TriCasterSwitcher (Id INTEGER PRIMARY KEY AUTO_INCREMENT, Name TEXT, Value TEXT, Products TEXT);
 CREATE TABLE TriCasterNetworkTarget (Id INTEGER PRIMARY KEY AUTO_INCREMENT, Name TEXT, Value TEXT, Products TEXT);
 
+CREATE INDEX IX_Configuration_Name ON Configuration (Name(191));
+CREATE INDEX IX_Device_Name ON Device (Name(191));
+CREATE INDEX IX_Device_Address ON Device (Address(191));
+CREATE INDEX IX_Library_DeviceId_TypeId ON Library (DeviceId, TypeId);
+CREATE INDEX IX_Library_Name ON Library (Name(191));
+CREATE INDEX IX_Library_ThumbnailId ON Library (ThumbnailId);
+
 INSERT INTO BlendMode (Value) VALUES('Normal');
 INSERT INTO BlendMode (Value) VALUES('Lighten');
 INSERT INTO BlendMode (Value) VALUES('Darken');
@@ -94,6 +101,9 @@ INSERT INTO Configuration (Name, Value) VALUES('NetworkCache', '1000');
 INSERT INTO Configuration (Name, Value) VALUES('StreamPort', '9250');
 INSERT INTO Configuration (Name, Value) VALUES('LogLevel', '-1');
 INSERT INTO Configuration (Name, Value) VALUES('UseDropFrameNotation', 'false');
+INSERT INTO Configuration (Name, Value) VALUES('DeferMixerCommandsInGroups', 'false');
+INSERT INTO Configuration (Name, Value) VALUES('OscInputInterval', '0');
+INSERT INTO Configuration (Name, Value) VALUES('LogFilterRules', '');
 INSERT INTO Configuration (Name, Value) VALUES('DatabaseVersion', '208');
 
 INSERT INTO Chroma (Value) VALUES('None');
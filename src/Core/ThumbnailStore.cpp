@@ -0,0 +1,220 @@
+#include "ThumbnailStore.h"
+
+#include "DatabaseManager.h"
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDebug>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QMetaObject>
+#include <QtCore/QRunnable>
+#include <QtCore/QSet>
+
+#include <QtSql/QSqlDatabase>
+
+Q_GLOBAL_STATIC(ThumbnailStore, thumbnailStore)
+
+namespace
+{
+    class ThumbnailDecoder : public QRunnable
+    {
+        public:
+            explicit ThumbnailDecoder(QObject* store, const QString& key, const QString& cacheKey, const QString& path, const QSize& size)
+                : store(store), key(key), cacheKey(cacheKey), path(path), size(size)
+            {
+            }
+
+            void run()
+            {
+                QImage image;
+
+                QFile file(this->path);
+                if (file.open(QIODevice::ReadOnly))
+                {
+                    // Decode straight from the mapped file, the PNG is never copied into memory first.
+                    uchar* data = file.map(0, file.size());
+                    if (data != NULL)
+                    {
+                        image.loadFromData(data, file.size(), "PNG");
+                        file.unmap(data);
+                    }
+                    else
+                    {
+                        image.loadFromData(file.readAll(), "PNG");
+                    }
+
+                    file.close();
+                }
+
+                if (!image.isNull() && this->size.isValid())
+                    image = image.scaled(this->size, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+
+                QMetaObject::invokeMethod(this->store, "decoded", Qt::QueuedConnection,
+                                          Q_ARG(QString, this->key), Q_ARG(QString, this->cacheKey), Q_ARG(QImage, image));
+            }
+
+        private:
+            QObject* store;
+            QString key;
+            QString cacheKey;
+            QString path;
+            QSize size;
+    };
+}
+
+ThumbnailStore::ThumbnailStore()
+{
+    this->threadPool.setMaxThreadCount(2);
+    this->pixmaps.setMaxCost(64 * 1024); // Kilobytes of decoded pixels.
+}
+
+ThumbnailStore& ThumbnailStore::getInstance()
+{
+    return *thumbnailStore();
+}
+
+void ThumbnailStore::initialize()
+{
+    // Every SQLite profile gets its own store next to the database file. The in memory database and a MySQL
+    // database shared between machines use a common store that is never pruned, the keys are content hashes so
+    // the files can be shared safely.
+    QSqlDatabase database = QSqlDatabase::database();
+    if (database.driverName() == "QSQLITE" && database.databaseName() != ":memory:")
+    {
+        QFileInfo databaseInfo(database.databaseName());
+
+        this->path = QString("%1/%2.Thumbnails").arg(databaseInfo.absolutePath()).arg(databaseInfo.completeBaseName());
+        this->pruneFiles = true;
+    }
+    else
+    {
+        this->path = QString("%1/.CasparCG/Client/SharedThumbnails").arg(QDir::homePath());
+        this->pruneFiles = false;
+    }
+
+    QDir directory(this->path);
+    if (!directory.exists())
+        directory.mkpath(".");
+
+    if (!this->pruneFiles)
+        return;
+
+    // Remove files no longer referenced, i.e. replaced by a newer timestamp or deleted with the library.
+    QSet<QString> keys = DatabaseManager::getInstance().getThumbnailKeys().toSet();
+    foreach (const QString& fileName, directory.entryList(QStringList() << "*.png", QDir::Files))
+    {
+        if (!keys.contains(QFileInfo(fileName).completeBaseName()))
+            directory.remove(fileName);
+    }
+}
+
+void ThumbnailStore::uninitialize()
+{
+    this->threadPool.clear();
+    this->threadPool.waitForDone();
+
+    this->pendingDecodes.clear();
+    this->failedKeys.clear();
+    this->pixmaps.clear();
+}
+
+QString ThumbnailStore::insert(const QByteArray& data)
+{
+    const QString key = QString::fromLatin1(QCryptographicHash::hash(data, QCryptographicHash::Sha1).toHex());
+
+    // An existing file already holds the same image.
+    QFile file(getPath(key));
+    if (!file.exists())
+    {
+        if (!file.open(QIODevice::WriteOnly) || file.write(data) != data.size())
+        {
+            qWarning("Failed to write thumbnail %s: %s", qPrintable(file.fileName()), qPrintable(file.errorString()));
+
+            file.remove();
+
+            return QString();
+        }
+
+        file.close();
+    }
+
+    this->failedKeys.remove(key);
+
+    return key;
+}
+
+void ThumbnailStore::clear()
+{
+    this->pendingDecodes.clear();
+    this->failedKeys.clear();
+    this->pixmaps.clear();
+
+    if (!this->pruneFiles)
+        return; // Other profiles may still reference the files.
+
+    QDir directory(this->path);
+    foreach (const QString& fileName, directory.entryList(QStringList() << "*.png", QDir::Files))
+        directory.remove(fileName);
+}
+
+QString ThumbnailStore::getPath(const QString& key) const
+{
+    return QString("%1/%2.png").arg(this->path).arg(key);
+}
+
+bool ThumbnailStore::contains(const QString& key) const
+{
+    return !key.isEmpty() && QFile::exists(getPath(key));
+}
+
+bool ThumbnailStore::hasFailed(const QString& key) const
+{
+    return this->failedKeys.contains(key);
+}
+
+QPixmap ThumbnailStore::getPixmap(const QString& key, const QSize& size)
+{
+    if (key.isEmpty() || this->failedKeys.contains(key))
+        return QPixmap();
+
+    const QString cacheKey = size.isValid() ? QString("%1@%2x%3").arg(key).arg(size.width()).arg(size.height()) : key;
+
+    QPixmap* cached = this->pixmaps.object(cacheKey);
+    if (cached != NULL)
+        return *cached;
+
+    // Every widget showing the same media waits for the same decode.
+    if (!this->pendingDecodes.contains(cacheKey))
+    {
+        this->pendingDecodes.insert(cacheKey);
+        this->threadPool.start(new ThumbnailDecoder(this, key, cacheKey, getPath(key), size));
+    }
+
+    return QPixmap();
+}
+
+void ThumbnailStore::decoded(const QString& key, const QString& cacheKey, const QImage& image)
+{
+    if (!this->pendingDecodes.remove(cacheKey))
+        return; // Cleared while decoding.
+
+    if (image.isNull())
+    {
+        // Remove a broken file as well, the next thumbnail listing then sees it as missing and retrieves it again.
+        qWarning("Unable to decode thumbnail %s", qPrintable(getPath(key)));
+
+        QFile::remove(getPath(key));
+        this->failedKeys.insert(key);
+
+        emit thumbnailFailed(key);
+
+        return;
+    }
+
+    // Only the upload to a pixmap is left on the GUI thread.
+    QPixmap* pixmap = new QPixmap(QPixmap::fromImage(image));
+    this->pixmaps.insert(cacheKey, pixmap, qMax(1, pixmap->width() * pixmap->height() * pixmap->depth() / 8 / 1024));
+
+    emit thumbnailDecoded(key);
+}
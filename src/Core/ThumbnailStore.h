@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Shared.h"
+
+#include <QtCore/QByteArray>
+#include <QtCore/QCache>
+#include <QtCore/QObject>
+#include <QtCore/QSet>
+#include <QtCore/QSize>
+#include <QtCore/QString>
+#include <QtCore/QThreadPool>
+
+#include <QtGui/QImage>
+#include <QtGui/QPixmap>
+
+// Thumbnails are kept as PNG files next to the SQLite database, the Thumbnail table only holds the key of the file.
+// The key is the hash of the PNG data, identical images share one file.
+// Files are decoded on a thread pool and the pixmaps are cached, the store is only used from the GUI thread except
+// for contains() and getPath().
+class CORE_EXPORT ThumbnailStore : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit ThumbnailStore();
+
+        static ThumbnailStore& getInstance();
+
+        void initialize();
+        void uninitialize();
+
+        QString insert(const QByteArray& data);
+        void clear();
+
+        QString getPath(const QString& key) const;
+
+        // A key without a file, e.g. from a database shared with another machine, counts as no thumbnail.
+        bool contains(const QString& key) const;
+
+        // Returns a null pixmap when the thumbnail is not decoded yet, thumbnailDecoded() is emitted once it is.
+        // thumbnailFailed() is emitted instead when the file is missing or broken, it is not decoded again until
+        // a new file is inserted.
+        QPixmap getPixmap(const QString& key, const QSize& size = QSize());
+        bool hasFailed(const QString& key) const;
+
+        Q_SIGNAL void thumbnailDecoded(const QString& key);
+        Q_SIGNAL void thumbnailFailed(const QString& key);
+
+    private:
+        QString path;
+        bool pruneFiles = false;
+        QThreadPool threadPool;
+        QSet<QString> pendingDecodes;
+        QSet<QString> failedKeys;
+        QCache<QString, QPixmap> pixmaps;
+
+        Q_SLOT void decoded(const QString& key, const QString& cacheKey, const QImage& image);
+};
@@ -2,69 +2,195 @@
 #include "DatabaseManager.h"
 #include "DeviceManager.h"
 #include "EventManager.h"
+#include "ThumbnailStore.h"
 #include "Events/MediaChangedEvent.h"
 #include "Events/StatusbarEvent.h"
+#include "Events/ThumbnailChangedEvent.h"
 
 #include "Global.h"
 
 #include "CasparDevice.h"
 
-#include <QtCore/QTimer>
+#include <functional>
+
+#include <QtCore/QMetaObject>
+#include <QtCore/QStringList>
 
 #include <QtWidgets/QApplication>
 
+namespace
+{
+    const int MAX_OUTSTANDING_RETRIEVES = 4;
+    const int RETRIEVE_TIMEOUT = 30000;
+    const int COMMIT_BATCH_SIZE = 50;
+    const int COMMIT_INTERVAL = 1000;
+}
+
 ThumbnailWorker::ThumbnailWorker(const QList<ThumbnailModel>& thumbnailModels, QObject* parent)
     : QObject(parent),
       thumbnailModels(thumbnailModels)
 {
-    QObject::connect(&this->thumbnailTimer, SIGNAL(timeout()), this, SLOT(process()));
+    if (!this->thumbnailModels.isEmpty())
+        this->address = this->thumbnailModels.at(0).getAddress();
+
+    this->commitTimer.setSingleShot(true);
+    this->commitTimer.setInterval(COMMIT_INTERVAL);
+
+    QObject::connect(&this->commitTimer, SIGNAL(timeout()), this, SLOT(commit()));
 }
 
 void ThumbnailWorker::start()
 {
-    this->thumbnailTimer.setInterval(2000); // Settings?
-    this->thumbnailTimer.start();
+    this->running = true;
+    this->time.start();
+
+    process();
+}
+
+void ThumbnailWorker::stop()
+{
+    // Replies still in flight are dropped, what was already retrieved is kept.
+    this->running = false;
+    this->thumbnailModels.clear();
+    this->priorityModels.clear();
+
+    commit();
 }
 
-void ThumbnailWorker::process()
+bool ThumbnailWorker::prioritize(const QString& name)
 {
-    if (this->thumbnailModels.count() == 0)
+    for (int i = 0; i < this->thumbnailModels.count(); i++)
     {
-        this->thumbnailTimer.stop();
-        EventManager::getInstance().fireMediaChangedEvent(MediaChangedEvent());
+        if (this->thumbnailModels.at(i).getName() != name)
+            continue;
 
-        return;
+        this->priorityModels.push_back(this->thumbnailModels.takeAt(i));
+
+        if (this->running)
+            QMetaObject::invokeMethod(this, "process", Qt::QueuedConnection);
+
+        return true;
+    }
+
+    foreach (const ThumbnailModel& model, this->priorityModels)
+    {
+        if (model.getName() == name)
+            return true;
     }
 
-    this->currentName = this->thumbnailModels.at(0).getName();
-    this->currentAddress = this->thumbnailModels.at(0).getAddress();
-    this->currentTimestamp= this->thumbnailModels.at(0).getTimestamp();
-    this->currentSize= this->thumbnailModels.at(0).getSize();
+    return false;
+}
+
+void ThumbnailWorker::retrieve(const ThumbnailModel& model)
+{
+    // Retrieves a thumbnail that is not part of the listing, a finished worker is started again.
+    this->priorityModels.push_back(model);
 
-    const QSharedPointer<DeviceModel> model = DeviceManager::getInstance().getDeviceModelByAddress(this->currentAddress);
-    if (model == NULL || model->getShadow() == "Yes")
+    if (this->running)
+        QMetaObject::invokeMethod(this, "process", Qt::QueuedConnection);
+    else
+        start();
+}
+
+void ThumbnailWorker::process()
+{
+    if (!this->running)
         return;
 
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(model->getName());
-    if (!device->isConnected())
+    QSharedPointer<CasparDevice> device;
+    const QSharedPointer<DeviceModel> model = DeviceManager::getInstance().getDeviceModelByAddress(this->address);
+    if (model != NULL && model->getShadow() != "Yes")
+        device = DeviceManager::getInstance().getDeviceByName(model->getName());
+
+    if (device == NULL || !device->isConnected())
+    {
+        // Whatever is left is retrieved again on the next listing.
+        this->thumbnailModels.clear();
+        this->priorityModels.clear();
+    }
+
+    while (this->outstanding < MAX_OUTSTANDING_RETRIEVES && (!this->priorityModels.isEmpty() || !this->thumbnailModels.isEmpty()))
     {
-        this->thumbnailTimer.stop();
-        EventManager::getInstance().fireMediaChangedEvent(MediaChangedEvent());
+        bool priority = !this->priorityModels.isEmpty();
+        ThumbnailModel thumbnailModel = priority ? this->priorityModels.takeFirst() : this->thumbnailModels.takeFirst();
 
-        return;
+        EventManager::getInstance().fireStatusbarEvent(StatusbarEvent(QString("Retrieving thumbnail %1...").arg(thumbnailModel.getName())));
+        qDebug("Retrieving thumbnail %s", qPrintable(thumbnailModel.getName()));
+
+        this->outstanding++;
+        device->retrieveThumbnail(thumbnailModel.getName(), std::bind(&ThumbnailWorker::forwardThumbnail, QPointer<ThumbnailWorker>(this), thumbnailModel, priority,
+                                                                      std::placeholders::_1, std::placeholders::_2), RETRIEVE_TIMEOUT);
     }
 
-    EventManager::getInstance().fireStatusbarEvent(StatusbarEvent(QString("Retrieving thumbnail %1...").arg(this->currentName)));
-    qDebug("Retrieving thumbnail %s", qPrintable(this->currentName));
+    if (this->outstanding == 0)
+        finish();
+}
+
+void ThumbnailWorker::forwardThumbnail(const QPointer<ThumbnailWorker>& worker, const ThumbnailModel& model, bool priority, int code, const QList<QString>& response)
+{
+    // Replies may arrive after the worker was stopped or replaced by a newer listing.
+    if (!worker.isNull() && worker->running)
+        worker->thumbnailRetrieved(model, priority, code, response);
+}
+
+void ThumbnailWorker::thumbnailRetrieved(const ThumbnailModel& model, bool priority, int code, const QList<QString>& response)
+{
+    this->outstanding--;
 
-    QObject::connect(device.data(), SIGNAL(thumbnailRetrieveChanged(const QString&, CasparDevice&)), this, SLOT(thumbnailRetrieveChanged(const QString&, CasparDevice&)));
-    device->retrieveThumbnail(this->currentName);
+    if (code == 201 && response.count() > 1)
+    {
+        // The image goes to the thumbnail store, the database only keeps its key.
+        const QString key = ThumbnailStore::getInstance().insert(QByteArray::fromBase64(response.at(1).toLatin1()));
+        if (!key.isEmpty())
+        {
+            this->retrievedModels.push_back(ThumbnailModel(0, key, model.getTimestamp(), model.getSize(), model.getName(), model.getAddress()));
+            this->retrieved++;
+        }
+    }
+    else
+    {
+        qDebug("Failed to retrieve thumbnail %s (%d)", qPrintable(model.getName()), code);
+    }
 
-    this->thumbnailModels.removeAt(0);
+    // A requested thumbnail is shown right away, the rest is written in batches.
+    if (priority || this->retrievedModels.count() >= COMMIT_BATCH_SIZE)
+        commit();
+    else if (!this->commitTimer.isActive())
+        this->commitTimer.start();
+
+    // Not called directly, the callback may run while the device is still aborting its pending commands.
+    QMetaObject::invokeMethod(this, "process", Qt::QueuedConnection);
 }
 
-void ThumbnailWorker::thumbnailRetrieveChanged(const QString& data, CasparDevice& device)
+void ThumbnailWorker::commit()
 {
-    QObject::disconnect(&device, SIGNAL(thumbnailRetrieveChanged(const QString&, CasparDevice&)), this, SLOT(thumbnailRetrieveChanged(const QString&, CasparDevice&)));
-    DatabaseManager::getInstance().updateThumbnail(ThumbnailModel(0, data, this->currentTimestamp, this->currentSize, this->currentName, this->currentAddress));
+    this->commitTimer.stop();
+
+    if (this->retrievedModels.isEmpty())
+        return;
+
+    DatabaseManager::getInstance().updateThumbnails(this->retrievedModels);
+
+    QStringList names;
+    foreach (const ThumbnailModel& model, this->retrievedModels)
+        names.push_back(model.getName());
+
+    this->retrievedModels.clear();
+
+    const QSharedPointer<DeviceModel> model = DeviceManager::getInstance().getDeviceModelByAddress(this->address);
+    if (model != NULL)
+        EventManager::getInstance().fireThumbnailChangedEvent(ThumbnailChangedEvent(model->getName(), names));
+}
+
+void ThumbnailWorker::finish()
+{
+    this->running = false;
+
+    commit();
+
+    int elapsed = this->time.elapsed();
+    if (this->retrieved > 0)
+        qDebug("Retrieved %d thumbnails from %s in %d msec (%.1f/sec)", this->retrieved, qPrintable(this->address), elapsed, this->retrieved * 1000.0 / qMax(1, elapsed));
+
+    EventManager::getInstance().fireMediaChangedEvent(MediaChangedEvent());
 }
@@ -10,9 +10,14 @@
 
 #include "Models/ThumbnailModel.h"
 
+#include <QtCore/QList>
 #include <QtCore/QObject>
+#include <QtCore/QPointer>
+#include <QtCore/QTime>
 #include <QtCore/QTimer>
 
+// Retrieves the thumbnails of one device. A few requests are kept in flight so the server is never idle waiting
+// for the client, requested items jump the queue and results are written to the database in batches.
 class CORE_EXPORT ThumbnailWorker : public QObject
 {
     Q_OBJECT
@@ -21,17 +26,28 @@ class CORE_EXPORT ThumbnailWorker : public QObject
         explicit ThumbnailWorker(const QList<ThumbnailModel>& thumbnailModels, QObject* parent = 0);
 
         void start();
+        void stop();
+        bool prioritize(const QString& name);
+        void retrieve(const ThumbnailModel& model);
 
     private:
-        QTimer thumbnailTimer;
+        QString address;
+        QTime time;
+        QTimer commitTimer;
 
-        QString currentName;
-        QString currentTimestamp;
-        QString currentSize;
-        QString currentAddress;
+        int outstanding = 0;
+        int retrieved = 0;
+        bool running = false;
 
         QList<ThumbnailModel> thumbnailModels;
+        QList<ThumbnailModel> priorityModels;
+        QList<ThumbnailModel> retrievedModels;
+
+        void finish();
+        void thumbnailRetrieved(const ThumbnailModel& model, bool priority, int code, const QList<QString>& response);
+
+        static void forwardThumbnail(const QPointer<ThumbnailWorker>& worker, const ThumbnailModel& model, bool priority, int code, const QList<QString>& response);
 
         Q_SLOT void process();
-        Q_SLOT void thumbnailRetrieveChanged(const QString& data, CasparDevice& device);
+        Q_SLOT void commit();
 };
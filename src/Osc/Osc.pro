@@ -7,17 +7,22 @@ TEMPLATE = lib
 
 DEFINES += OSC_LIBRARY
 
+DEPENDPATH += $$PWD/../Common
+INCLUDEPATH += $$PWD/../Common
+
 HEADERS += \
     Shared.h \
     OscThread.h \
     OscListener.h \
     OscSender.h \
+    OscTransmitter.h \
     OscWebSocketListener.h
 
 SOURCES += \
     OscThread.cpp \
     OscListener.cpp \
     OscSender.cpp \
+    OscTransmitter.cpp \
     OscWebSocketListener.cpp
 
 CONFIG(system-boost) {
@@ -1,5 +1,8 @@
 #include "OscListener.h"
 
+#include <cstring>
+
+#include <QtCore/QMetaObject>
 #include <QtCore/QString>
 #include <QtCore/QThread>
 #include <QtCore/QTimer>
@@ -7,8 +10,14 @@
 #include <QtCore/QDebug>
 
 OscListener::OscListener(const QString& address, int port, QObject* parent)
-    : QObject(parent)
+    : QObject(parent),
+      queue(8192), controlQueue(1024), droppedMessages(0), controlScheduled(false)
 {
+    // Messages are drained on the GUI thread at a steady cadence, the default matches a 25 fps channel.
+    this->flushTimer.setTimerType(Qt::PreciseTimer);
+    this->flushTimer.setInterval(40);
+    QObject::connect(&this->flushTimer, SIGNAL(timeout()), this, SLOT(sendEventBatch()));
+
     try
     {
         this->port = port;
@@ -24,7 +33,7 @@ OscListener::OscListener(const QString& address, int port, QObject* parent)
 
         this->thread = new OscThread(this->multiplexer, this);
 
-        QTimer::singleShot(200, this, SLOT(sendEventBatch()));
+        this->flushTimer.start();
     }
     catch (std::runtime_error &e)
     {
@@ -50,6 +59,11 @@ void OscListener::start()
         this->thread->start();
 }
 
+void OscListener::setFlushInterval(int interval)
+{
+    this->flushTimer.setInterval(interval);
+}
+
 void OscListener::ProcessMessage(const osc::ReceivedMessage& message, const IpEndpointName& endpoint)
 {
     char addressBuffer[256];
@@ -75,34 +89,71 @@ void OscListener::ProcessMessage(const osc::ReceivedMessage& message, const IpEn
             arguments.append(argument.AsString());
     }
 
-    QString eventMessage = QString("%1").arg(message.AddressPattern());
-    QString eventPath = QString("%1%2").arg(addressBuffer).arg(message.AddressPattern());
-
-    //qDebug("DEBUG: OSC message received: %s", eventPath);
+    OscMessage event;
+    event.path = QString("%1%2").arg(addressBuffer).arg(message.AddressPattern());
+    event.arguments = arguments;
 
-    QMutexLocker locker(&eventsMutex);
-    if (eventMessage.startsWith("/control"))
+    // This is the only producer for both queues.
+    if (std::strncmp(message.AddressPattern(), "/control", 8) == 0)
     {
-        qDebug("Received OSC message from %s:%d: %s", qPrintable(addressBuffer), this->port, qPrintable(eventMessage));
-
-        // Do not overwrite control commands already in queue.
-        if (!this->events.contains(eventPath))
-            this->events[eventPath] = arguments;
+        // Control commands bypass the batching. Every one is delivered in order, only the first of a burst wakes up
+        // the GUI thread.
+        event.timer.start();
+        while (!this->controlQueue.push(event))
+        {
+            // The GUI thread is behind, e.g. in a modal dialog. Make sure one batch is pending and back off instead
+            // of posting an event on every retry.
+            if (!this->controlScheduled.exchange(true))
+                QMetaObject::invokeMethod(this, "sendControlBatch", Qt::QueuedConnection);
+
+            QThread::msleep(1);
+        }
+
+        if (!this->controlScheduled.exchange(true))
+            QMetaObject::invokeMethod(this, "sendControlBatch", Qt::QueuedConnection);
+
+        return;
     }
-    else
-        this->events[eventPath] = arguments;
+
+    // Status messages are dropped when the GUI falls behind, they are superseded by the next ones anyway.
+    if (!this->queue.push(event))
+        this->droppedMessages.fetch_add(1, std::memory_order_relaxed);
+}
+
+void OscListener::sendControlBatch()
+{
+    this->controlScheduled.store(false);
+
+    OscMessage event;
+    while (this->controlQueue.pop(event))
+        emit controlReceived(event.path, event.arguments, event.timer);
 }
 
 void OscListener::sendEventBatch()
 {
-    QMap<QString, QList<QVariant>> other;
+    // Coalesce per path, the latest status wins. Paths are emitted in the order they first arrived.
+    QList<OscMessage> events;
+    QHash<QString, int> indexes;
+
+    OscMessage event;
+    while (this->queue.pop(event))
     {
-        QMutexLocker locker(&eventsMutex);
-        this->events.swap(other);
+        QHash<QString, int>::const_iterator iterator = indexes.constFind(event.path);
+        if (iterator == indexes.constEnd())
+        {
+            indexes.insert(event.path, events.count());
+            events.append(event);
+        }
+        else
+        {
+            events[iterator.value()].arguments = event.arguments;
+        }
     }
 
-    foreach (const QString& eventPath, other.keys())
-        emit messageReceived(eventPath, other[eventPath]);
+    int droppedMessages = this->droppedMessages.exchange(0, std::memory_order_relaxed);
+    if (droppedMessages > 0)
+        qWarning("Dropped %d OSC messages received on port %d", droppedMessages, this->port);
 
-    QTimer::singleShot(200, this, SLOT(sendEventBatch()));
+    foreach (const OscMessage& event, events)
+        emit messageReceived(event.path, event.arguments);
 }
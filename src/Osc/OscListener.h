@@ -3,14 +3,21 @@
 #include "Shared.h"
 #include "OscThread.h"
 
+#include "SpscQueue.h"
+
+#include <atomic>
+
 #include <osc/OscReceivedElements.h>
 #include <osc/OscPacketListener.h>
 #include <ip/UdpSocket.h>
 
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QHash>
+#include <QtCore/QList>
 #include <QtCore/QObject>
-#include <QtCore/QMap>
+#include <QtCore/QString>
+#include <QtCore/QTimer>
 #include <QtCore/QVariant>
-#include <QtCore/QMutex>
 
 class OSC_EXPORT OscListener : public QObject, public osc::OscPacketListener
 {
@@ -21,19 +28,36 @@ class OSC_EXPORT OscListener : public QObject, public osc::OscPacketListener
         ~OscListener();
 
         void start();
+        void setFlushInterval(int interval);
 
         Q_SIGNAL void messageReceived(const QString&, const QList<QVariant>&);
 
+        // Emitted for every /control message as soon as the GUI thread gets to it. The timer was started when the
+        // message was received.
+        Q_SIGNAL void controlReceived(const QString&, const QList<QVariant>&, const QElapsedTimer&);
+
     protected:
         virtual void ProcessMessage(const osc::ReceivedMessage& message, const IpEndpointName& endpoint);
 
     private:
+        struct OscMessage
+        {
+            QString path;
+            QList<QVariant> arguments;
+            QElapsedTimer timer;
+        };
+
         int port;
-        QMutex eventsMutex;
-        QMap<QString, QList<QVariant>> events;
         OscThread* thread = nullptr;
         UdpSocket* socket = nullptr;
         SocketReceiveMultiplexer* multiplexer = nullptr;
 
+        SpscQueue<OscMessage> queue;
+        SpscQueue<OscMessage> controlQueue;
+        std::atomic<int> droppedMessages;
+        std::atomic<bool> controlScheduled;
+        QTimer flushTimer;
+
         Q_SLOT void sendEventBatch();
+        Q_SLOT void sendControlBatch();
 };
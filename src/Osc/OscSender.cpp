@@ -1,40 +1,130 @@
 #include "OscSender.h"
+#include "OscTransmitter.h"
 
-#include <QtCore/QString>
-#include <QtCore/QVariant>
+#include <osc/OscOutboundPacketStream.h>
+
+#include <QtCore/QDebug>
+#include <QtCore/QMetaObject>
+#include <QtCore/QThread>
+
+namespace
+{
+    void writeMessage(osc::OutboundPacketStream& stream, const OscOutboundMessage& message)
+    {
+        const QByteArray path = message.path.toUtf8();
+
+        stream << osc::BeginMessage(path.constData());
+        foreach (const QVariant& argument, message.arguments)
+        {
+            switch (static_cast<QMetaType::Type>(argument.type()))
+            {
+                case QMetaType::Bool:
+                    stream << argument.toBool();
+                    break;
+                case QMetaType::Double:
+                    stream << argument.toDouble();
+                    break;
+                case QMetaType::Float:
+                    stream << argument.toFloat();
+                    break;
+                case QMetaType::Int:
+                    stream << static_cast<osc::int32>(argument.toInt());
+                    break;
+                case QMetaType::LongLong:
+                    stream << static_cast<osc::int64>(argument.toLongLong());
+                    break;
+                default:
+                    stream << argument.toString().toUtf8().constData();
+                    break;
+            }
+        }
+        stream << osc::EndMessage;
+    }
+}
 
 OscSender::OscSender(QObject* parent)
     : QObject(parent)
 {
+    this->thread = new QThread(this);
+    this->thread->setObjectName("OSC sender");
+
+    this->transmitter = new OscTransmitter();
+    this->transmitter->moveToThread(this->thread);
+
+    QObject::connect(this->thread, SIGNAL(finished()), this->transmitter, SLOT(deleteLater()));
+
+    this->thread->start();
 }
 
 OscSender::~OscSender()
 {
+    this->thread->quit();
+    this->thread->wait();
 }
 
 void OscSender::send(const QString& address, int port, const QString& path, const QVariant& message, bool useBundle)
 {
-    UdpTransmitSocket transmitSocket(IpEndpointName(address.toStdString().c_str(), port));
+    OscOutboundMessage outboundMessage;
+    outboundMessage.path = path;
+    outboundMessage.arguments.append(message);
+
+    transmit(address, port, createPacket(QList<OscOutboundMessage>() << outboundMessage, useBundle, 1));
+}
+
+void OscSender::send(const QString& address, int port, const QString& path, const QList<QVariant>& arguments)
+{
+    OscOutboundMessage outboundMessage;
+    outboundMessage.path = path;
+    outboundMessage.arguments = arguments;
 
-    char buffer[256];
-    osc::OutboundPacketStream stream(buffer, 256);
+    transmit(address, port, createPacket(QList<OscOutboundMessage>() << outboundMessage, false, 1));
+}
+
+void OscSender::sendBundle(const QString& address, int port, const QList<OscOutboundMessage>& messages, quint64 timeTag)
+{
+    if (messages.isEmpty())
+        return;
+
+    transmit(address, port, createPacket(messages, true, timeTag));
+}
+
+QByteArray OscSender::createPacket(const QList<OscOutboundMessage>& messages, bool useBundle, quint64 timeTag)
+{
+    // oscpack throws when the buffer is too small, grow it until the packet fits.
+    for (int size = 1024; ; size *= 2)
+    {
+        QByteArray buffer(size, Qt::Uninitialized);
+        try
+        {
+            osc::OutboundPacketStream stream(buffer.data(), buffer.size());
+
+            if (useBundle)
+                stream << osc::BeginBundle(timeTag);
+
+            foreach (const OscOutboundMessage& message, messages)
+                writeMessage(stream, message);
 
-    if (useBundle)
-        stream << osc::BeginBundleImmediate;
+            if (useBundle)
+                stream << osc::EndBundle;
 
-    if (message.type() == QMetaType::Bool)
-        stream << osc::BeginMessage(path.toStdString().c_str()) << message.toBool() << osc::EndMessage;
-    else if (message.type() == QMetaType::Double)
-        stream << osc::BeginMessage(path.toStdString().c_str()) << message.toDouble() << osc::EndMessage;
-    else if (message.type() == QMetaType::Float)
-        stream << osc::BeginMessage(path.toStdString().c_str()) << message.toFloat() << osc::EndMessage;
-    else if (message.type() == QMetaType::Int)
-        stream << osc::BeginMessage(path.toStdString().c_str()) << message.toInt() << osc::EndMessage;
-    else if (message.type() == QMetaType::QString)
-        stream << osc::BeginMessage(path.toStdString().c_str()) << message.toString().toUtf8().constData() << osc::EndMessage;
+            buffer.truncate(stream.Size());
 
-    if (useBundle)
-        stream << osc::EndBundle;
+            return buffer;
+        }
+        catch (osc::OutOfBufferMemoryException&)
+        {
+        }
+    }
+}
+
+void OscSender::transmit(const QString& address, int port, const QByteArray& packet)
+{
+    if (packet.size() > 65507)
+    {
+        qWarning("OSC packet to %s:%d is too large for a datagram (%d bytes)", qPrintable(address), port, packet.size());
+        return;
+    }
 
-    transmitSocket.Send(stream.Data(), stream.Size());
+    QMetaObject::invokeMethod(this->transmitter, "transmit", Qt::QueuedConnection,
+                              Q_ARG(QString, address), Q_ARG(int, port), Q_ARG(QByteArray, packet));
 }
@@ -2,14 +2,23 @@
 
 #include "Shared.h"
 
-#include "osc/OscOutboundPacketStream.h"
-#include <ip/UdpSocket.h>
-
+#include <QtCore/QByteArray>
+#include <QtCore/QList>
 #include <QtCore/QObject>
-#include <QtCore/QMap>
+#include <QtCore/QString>
 #include <QtCore/QVariant>
-#include <QtCore/QMutex>
 
+class QThread;
+
+class OscTransmitter;
+
+struct OscOutboundMessage
+{
+    QString path;
+    QList<QVariant> arguments;
+};
+
+// Packets are serialized on the calling thread and sent from a dedicated thread over one socket per destination.
 class OSC_EXPORT OscSender : public QObject
 {
     Q_OBJECT
@@ -19,7 +28,17 @@ class OSC_EXPORT OscSender : public QObject
         ~OscSender();
 
         void send(const QString& address, int port, const QString& path, const QVariant& message, bool useBundle);
+        void send(const QString& address, int port, const QString& path, const QList<QVariant>& arguments);
+
+        // All messages go out in one datagram and are applied together by the receiver. A time tag of 1 means
+        // immediately.
+        void sendBundle(const QString& address, int port, const QList<OscOutboundMessage>& messages, quint64 timeTag = 1);
+
+        static QByteArray createPacket(const QList<OscOutboundMessage>& messages, bool useBundle, quint64 timeTag = 1);
 
     private:
-        bool useBundle;
+        QThread* thread = nullptr;
+        OscTransmitter* transmitter = nullptr;
+
+        void transmit(const QString& address, int port, const QByteArray& packet);
 };
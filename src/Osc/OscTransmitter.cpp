@@ -0,0 +1,38 @@
+#include "OscTransmitter.h"
+
+#include <stdexcept>
+
+#include <ip/UdpSocket.h>
+
+#include <QtCore/QDebug>
+
+OscTransmitter::OscTransmitter(QObject* parent)
+    : QObject(parent)
+{
+}
+
+OscTransmitter::~OscTransmitter()
+{
+    qDeleteAll(this->sockets);
+}
+
+void OscTransmitter::transmit(const QString& address, int port, const QByteArray& packet)
+{
+    const QString key = QString("%1:%2").arg(address).arg(port);
+
+    try
+    {
+        UdpTransmitSocket* socket = this->sockets.value(key);
+        if (socket == nullptr)
+        {
+            socket = new UdpTransmitSocket(IpEndpointName(address.toUtf8().constData(), port));
+            this->sockets.insert(key, socket);
+        }
+
+        socket->Send(packet.constData(), packet.size());
+    }
+    catch (std::runtime_error& e)
+    {
+        qWarning("Failed to send OSC packet to %s: %s", qPrintable(key), e.what());
+    }
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Shared.h"
+
+#include <QtCore/QByteArray>
+#include <QtCore/QHash>
+#include <QtCore/QObject>
+#include <QtCore/QString>
+
+class UdpTransmitSocket;
+
+// Owns one UDP socket per destination on the sender thread. Sockets are created on first use and kept for the
+// lifetime of the transmitter.
+class OSC_EXPORT OscTransmitter : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit OscTransmitter(QObject* parent = 0);
+        ~OscTransmitter();
+
+        Q_SLOT void transmit(const QString& address, int port, const QByteArray& packet);
+
+    private:
+        QHash<QString, UdpTransmitSocket*> sockets;
+};
@@ -1,11 +1,15 @@
 #include "OscWebSocketListener.h"
+#include "OscSender.h"
+
+#include <osc/OscException.h>
+#include <osc/OscReceivedElements.h>
 
 #include <QtCore/QJsonArray>
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonObject>
-#include <QtCore/QJsonValue>
+#include <QtCore/QMetaObject>
 #include <QtCore/QString>
-#include <QtCore/QTimer>
+#include <QtCore/QUrlQuery>
 #include <QtCore/QDebug>
 
 #include <QtWebSockets/QWebSocket>
@@ -18,7 +22,9 @@ OscWebSocketListener::OscWebSocketListener(QObject* parent)
 
 OscWebSocketListener::~OscWebSocketListener()
 {
-    this->server->close();
+    if (this->server != nullptr)
+        this->server->close();
+
     qDeleteAll(this->sockets.begin(), this->sockets.end());
 }
 
@@ -45,8 +51,116 @@ void OscWebSocketListener::newConnection()
 
     QObject::connect(socket, SIGNAL(disconnected()), this, SLOT(disconnected()));
     QObject::connect(socket, SIGNAL(textMessageReceived(QString)), this, SLOT(textMessageReceived(QString)));
+    QObject::connect(socket, SIGNAL(binaryMessageReceived(QByteArray)), this, SLOT(binaryMessageReceived(QByteArray)));
 
     this->sockets.append(socket);
+
+    // Clients connecting with ?format=json get text frames, everyone else gets OSC bundles.
+    if (QUrlQuery(socket->requestUrl()).queryItemValue("format") == "json")
+        this->jsonSockets.insert(socket);
+
+    // Bring the client up to date with the last known value of every address.
+    if (!this->values.isEmpty())
+    {
+        QStringList paths = this->values.keys();
+        if (this->jsonSockets.contains(socket))
+            socket->sendTextMessage(createTextFrame(paths));
+        else
+            socket->sendBinaryMessage(createBinaryFrame(paths));
+    }
+}
+
+void OscWebSocketListener::publish(const QString& path, const QList<QVariant>& arguments)
+{
+    this->values.insert(path, arguments);
+
+    if (this->sockets.isEmpty())
+        return;
+
+    if (!this->pendingPathSet.contains(path))
+    {
+        this->pendingPathSet.insert(path);
+        this->pendingPaths.append(path);
+    }
+
+    if (!this->flushScheduled)
+    {
+        this->flushScheduled = true;
+        QMetaObject::invokeMethod(this, "flush", Qt::QueuedConnection);
+    }
+}
+
+void OscWebSocketListener::flush()
+{
+    this->flushScheduled = false;
+
+    if (this->pendingPaths.isEmpty())
+        return;
+
+    // Each format is only encoded once per batch, and only if some client uses it.
+    QByteArray binaryFrame;
+    QString textFrame;
+    foreach (QWebSocket* socket, this->sockets)
+    {
+        if (this->jsonSockets.contains(socket))
+        {
+            if (textFrame.isEmpty())
+                textFrame = createTextFrame(this->pendingPaths);
+
+            socket->sendTextMessage(textFrame);
+        }
+        else
+        {
+            if (binaryFrame.isEmpty())
+                binaryFrame = createBinaryFrame(this->pendingPaths);
+
+            socket->sendBinaryMessage(binaryFrame);
+        }
+    }
+
+    this->pendingPaths.clear();
+    this->pendingPathSet.clear();
+}
+
+QString OscWebSocketListener::createAddress(const QString& path)
+{
+    // Published paths are prefixed with the server address, e.g. 127.0.0.1/channel/1/..., which is not a valid OSC
+    // address on its own.
+    if (path.startsWith('/'))
+        return path;
+
+    return QString("/%1").arg(path);
+}
+
+QByteArray OscWebSocketListener::createBinaryFrame(const QStringList& paths) const
+{
+    QList<OscOutboundMessage> messages;
+    foreach (const QString& path, paths)
+    {
+        OscOutboundMessage message;
+        message.path = createAddress(path);
+        message.arguments = this->values.value(path);
+
+        messages.append(message);
+    }
+
+    return OscSender::createPacket(messages, true);
+}
+
+QString OscWebSocketListener::createTextFrame(const QStringList& paths) const
+{
+    QJsonArray messages;
+    foreach (const QString& path, paths)
+    {
+        QJsonArray message;
+        message.append(createAddress(path));
+        foreach (const QVariant& argument, this->values.value(path))
+            message.append(QJsonValue::fromVariant(argument));
+
+        messages.append(message);
+    }
+
+    return QString::fromUtf8(QJsonDocument(messages).toJson(QJsonDocument::Compact));
 }
 
 /*
@@ -57,19 +171,57 @@ void OscWebSocketListener::newConnection()
  *      "args" : [ arg1, arg2, ... ]
  * }
  *
+ * Several messages can be sent in one frame as an array, where each message is either an object as above or a
+ * compact array of the path followed by the arguments.
+ *
+ * [
+ *      [ "/valid/path", arg1, arg2, ... ],
+ *      { "path" : "/valid/path", "args" : [ arg1, arg2, ... ] }
+ * ]
+ *
+ * Binary frames carry a raw OSC message or bundle.
+ *
+ * Status sent to clients uses the same formats, an OSC bundle per binary frame or a JSON array of compact messages
+ * per text frame (?format=json). The address of the server the status came from is the first path element, e.g.
+ * "/192.168.0.10/channel/1/stage/layer/10/file/time".
+ *
  * For a complete list of valid OSC paths, look in Global.h. First argument
  * must always be a number greater than zero to be executed.
  */
 void OscWebSocketListener::textMessageReceived(const QString& message)
 {
     QJsonDocument document = QJsonDocument::fromJson(message.toUtf8());
-    QJsonObject object = document.object();
+    if (document.isArray())
+    {
+        QJsonArray messages = document.array();
+        for (int i = 0; i < messages.count(); i++)
+            processJson(messages[i]);
+    }
+    else
+    {
+        processJson(document.object());
+    }
+}
 
-    QString path = object.value("path").toString();
+void OscWebSocketListener::processJson(const QJsonValue& value)
+{
+    QString path;
+    QJsonArray array;
+    int first = 0;
+    if (value.isArray())
+    {
+        array = value.toArray();
+        path = array.first().toString();
+        first = 1;
+    }
+    else
+    {
+        path = value.toObject().value("path").toString();
+        array = value.toObject().value("args").toArray();
+    }
 
     QList<QVariant> arguments;
-    QJsonArray array = object.value("args").toArray();
-    for (int i = 0; i < array.count(); i++)
+    for (int i = first; i < array.count(); i++)
     {
         if (array[i].isBool())
             arguments.append(array[i].toBool());
@@ -83,15 +235,68 @@ void OscWebSocketListener::textMessageReceived(const QString& message)
         emit messageReceived(path, arguments);
 }
 
-void OscWebSocketListener::disconnected()
+void OscWebSocketListener::binaryMessageReceived(const QByteArray& message)
 {
-    QWebSocket* socket = qobject_cast<QWebSocket*>(QObject::sender());
+    try
+    {
+        osc::ReceivedPacket packet(message.constData(), message.size());
+        if (packet.IsBundle())
+            processBundle(osc::ReceivedBundle(packet));
+        else
+            processMessage(osc::ReceivedMessage(packet));
+    }
+    catch (osc::Exception& e)
+    {
+        qWarning("Ignoring malformed OSC packet received over WebSocket: %s", e.what());
+    }
+}
 
-    qDebug("Client %s was disconnected", qPrintable(socket->peerAddress().toString()));
+void OscWebSocketListener::processBundle(const osc::ReceivedBundle& bundle)
+{
+    for (osc::ReceivedBundle::const_iterator iterator = bundle.ElementsBegin(); iterator != bundle.ElementsEnd(); ++iterator)
+    {
+        if (iterator->IsBundle())
+            processBundle(osc::ReceivedBundle(*iterator));
+        else
+            processMessage(osc::ReceivedMessage(*iterator));
+    }
+}
+
+void OscWebSocketListener::processMessage(const osc::ReceivedMessage& message)
+{
+    QList<QVariant> arguments;
+    for (osc::ReceivedMessage::const_iterator iterator = message.ArgumentsBegin(); iterator != message.ArgumentsEnd(); ++iterator)
+    {
+        const osc::ReceivedMessageArgument& argument = *iterator;
 
+        if (argument.IsBool())
+            arguments.append(argument.AsBool());
+        else if (argument.IsInt32())
+            arguments.append(QVariant::fromValue<qint32>(argument.AsInt32()));
+        else if (argument.IsInt64())
+            arguments.append(QVariant::fromValue<qint64>(argument.AsInt64()));
+        else if (argument.IsFloat())
+            arguments.append(argument.AsFloat());
+        else if (argument.IsDouble())
+            arguments.append(argument.AsDouble());
+        else if (argument.IsString())
+            arguments.append(argument.AsString());
+    }
+
+    QString path = QString::fromUtf8(message.AddressPattern());
+    if (!path.isEmpty() && arguments.count() > 0)
+        emit messageReceived(path, arguments);
+}
+
+void OscWebSocketListener::disconnected()
+{
+    QWebSocket* socket = qobject_cast<QWebSocket*>(QObject::sender());
     if (socket != nullptr)
     {
+        qDebug("Client %s was disconnected", qPrintable(socket->peerAddress().toString()));
+
         this->sockets.removeAll(socket);
+        this->jsonSockets.remove(socket);
         socket->deleteLater();
     }
 }
@@ -2,13 +2,24 @@
 
 #include "Shared.h"
 
+#include <QtCore/QByteArray>
+#include <QtCore/QHash>
+#include <QtCore/QJsonValue>
 #include <QtCore/QList>
 #include <QtCore/QObject>
+#include <QtCore/QSet>
+#include <QtCore/QStringList>
 #include <QtCore/QVariant>
 
 class QWebSocket;
 class QWebSocketServer;
 
+namespace osc
+{
+    class ReceivedBundle;
+    class ReceivedMessage;
+}
+
 class OSC_EXPORT OscWebSocketListener : public QObject
 {
     Q_OBJECT
@@ -19,13 +30,34 @@ class OSC_EXPORT OscWebSocketListener : public QObject
 
         void start(int port);
 
+        // Remembers the value and forwards it to every client with the next batch. Updates published during the
+        // same event loop turn go out in one frame.
+        Q_SLOT void publish(const QString& path, const QList<QVariant>& arguments);
+
         Q_SIGNAL void messageReceived(const QString&, const QList<QVariant>&);
 
     private:
         QList<QWebSocket*> sockets;
+        QSet<QWebSocket*> jsonSockets;
         QWebSocketServer* server = nullptr;
 
+        QHash<QString, QList<QVariant>> values;
+        QStringList pendingPaths;
+        QSet<QString> pendingPathSet;
+        bool flushScheduled = false;
+
+        static QString createAddress(const QString& path);
+
+        QByteArray createBinaryFrame(const QStringList& paths) const;
+        QString createTextFrame(const QStringList& paths) const;
+
+        void processBundle(const osc::ReceivedBundle& bundle);
+        void processMessage(const osc::ReceivedMessage& message);
+        void processJson(const QJsonValue& value);
+
+        Q_SLOT void flush();
         Q_SLOT void disconnected();
         Q_SLOT void newConnection();
         Q_SLOT void textMessageReceived(const QString& message);
+        Q_SLOT void binaryMessageReceived(const QByteArray& message);
 };
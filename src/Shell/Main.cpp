@@ -1,5 +1,6 @@
 #include "Version.h"
 #include "Global.h"
+#include "Logger.h"
 
 #include "Application.h"
 
@@ -7,6 +8,7 @@
 #include "../Core/EventManager.h"
 #include "../Core/GpiManager.h"
 #include "../Core/LibraryManager.h"
+#include "../Core/ThumbnailStore.h"
 #include "../Core/DeviceManager.h"
 #include "../Core/OscDeviceManager.h"
 #include "../Core/OscWebSocketManager.h"
@@ -18,9 +20,8 @@
 
 #include <QtCore/QRegExp>
 #include <QtCore/QDir>
-#include <QtCore/QFile>
+#include <QtCore/QLoggingCategory>
 #include <QtCore/QString>
-#include <QtCore/QTextStream>
 #include <QtCore/QCommandLineParser>
 #include <QtCore/QCommandLineOption>
 
@@ -57,45 +58,37 @@ enum CommandLineParseResult
 
 void messageHandler(QtMsgType type, const QMessageLogContext& context, const QString& message)
 {
-    Q_UNUSED(context);
-
     QString logMessage;
     QString threadId = QString::number((long long)QThread::currentThreadId(), 16);
     QString timestamp = QDateTime::currentDateTime().toString("yyyy-MM-dd hh:mm:ss.zzz");
 
+    // Prefix the category name for everything logged through qCDebug() and friends.
+    QString text = message;
+    if (context.category != nullptr && qstrcmp(context.category, "default") != 0)
+        text = QString("[%1] %2").arg(context.category).arg(message);
+
     switch (type)
     {
         case QtDebugMsg:
-            logMessage = QString("[%1] [%2] [D] %3").arg(timestamp).arg(threadId).arg(message);
+            logMessage = QString("[%1] [%2] [D] %3").arg(timestamp).arg(threadId).arg(text);
             break;
         case QtWarningMsg:
-            logMessage = QString("[%1] [%2] [W] %3").arg(timestamp).arg(threadId).arg(message);
+            logMessage = QString("[%1] [%2] [W] %3").arg(timestamp).arg(threadId).arg(text);
             break;
         case QtCriticalMsg:
-            logMessage = QString("[%1] [%2] [C] %3").arg(timestamp).arg(threadId).arg(message);
+            logMessage = QString("[%1] [%2] [C] %3").arg(timestamp).arg(threadId).arg(text);
             break;
         case QtFatalMsg:
-            logMessage = QString("[%1] [%2] [F] %3").arg(timestamp).arg(threadId).arg(message);
+            logMessage = QString("[%1] [%2] [F] %3").arg(timestamp).arg(threadId).arg(text);
     }
 
-    fprintf(stderr, "%s\n", qPrintable(logMessage));
-
-    QString path = QString("%1/.CasparCG/Client/Logs").arg(QDir::homePath());
-
-    QDir directory(path);
-    if (!directory.exists())
-        directory.mkpath(".");
-
-    QFile logFile(QString("%1/Client_%2.log").arg(path).arg(QDateTime::currentDateTime().toString("yyyy-MM-dd")));
-    logFile.open(QIODevice::WriteOnly | QIODevice::Append);
-
-    QTextStream logStream(&logFile);
-    logStream << logMessage << endl;
-
-    logFile.close();
+    Logger::getInstance().write(type, logMessage);
 
     if (type == QtFatalMsg)
-       abort();
+    {
+        Logger::getInstance().uninitialize();
+        abort();
+    }
 }
 
 void loadDatabase(CommandLineArgs* args)
@@ -143,6 +136,14 @@ void loadDatabase(CommandLineArgs* args)
         qCritical("Unable to open database");
 }
 
+void loadLogFilterRules()
+{
+    // Rules use the QLoggingCategory syntax separated by semicolons, e.g. "casparcg.amcp.debug=false".
+    QString rules = DatabaseManager::getInstance().getConfigurationByName("LogFilterRules").getValue();
+    if (!rules.isEmpty())
+        QLoggingCategory::setFilterRules(rules.replace(';', '\n'));
+}
+
 void loadStyleSheets(QApplication& application)
 {
     QString stylesheet;
@@ -282,6 +283,7 @@ int main(int argc, char* argv[])
     qputenv("QT_STYLE_OVERRIDE", "plastique");
 
     qInstallMessageHandler(messageHandler);
+    Logger::getInstance().initialize(QString("%1/.CasparCG/Client/Logs").arg(QDir::homePath()));
 
     Application application(argc, argv);
     application.setApplicationName("CasparCG Client");
@@ -312,6 +314,8 @@ int main(int argc, char* argv[])
 
     loadDatabase(&args);
     DatabaseManager::getInstance().initialize();
+    loadLogFilterRules();
+    ThumbnailStore::getInstance().initialize();
 
     loadStyleSheets(application);
     loadFonts(application);
@@ -344,6 +348,9 @@ int main(int argc, char* argv[])
     AtemDeviceManager::getInstance().uninitialize();
     DeviceManager::getInstance().uninitialize();
     LibraryManager::getInstance().uninitialize();
+    ThumbnailStore::getInstance().uninitialize();
+
+    Logger::getInstance().uninitialize();
 
     return returnValue;
 }
@@ -14,8 +14,10 @@ SUBDIRS += \
     Repository \
     Core \
     Widgets \
-    Shell
+    Shell \
+    Tests
 
 Core.depends = Atem Caspar TriCaster Osc Gpi Common
 Widgets.depends = Atem Caspar TriCaster Panasonic Sony Spyder Web Osc Repository Gpi Common Core
 Shell.depends = Atem Caspar TriCaster Panasonic Sony Spyder Web Osc Repository Gpi Common Core Widgets
+Tests.depends = Atem Caspar TriCaster Osc Gpi Common Core
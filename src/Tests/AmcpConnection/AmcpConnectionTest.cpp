@@ -0,0 +1,141 @@
+#include "AmcpConnection.h"
+
+#include <QtCore/QByteArray>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QStringList>
+
+#include <QtNetwork/QHostAddress>
+#include <QtNetwork/QTcpServer>
+#include <QtNetwork/QTcpSocket>
+
+#include <QtTest/QSignalSpy>
+#include <QtTest/QtTest>
+
+class AmcpConnectionTest : public QObject
+{
+    Q_OBJECT
+
+    private:
+        QTcpServer* server = nullptr;
+        QTcpSocket* peer = nullptr;
+        AmcpConnection* connection = nullptr;
+        QSignalSpy* spy = nullptr;
+
+        void send(const QList<QByteArray>& chunks);
+        QStringList receivedLines() const;
+
+        Q_SLOT void init();
+        Q_SLOT void cleanup();
+
+        Q_SLOT void splitsOnCrLf();
+        Q_SLOT void joinsLinesAcrossReads();
+        Q_SLOT void keepsBareLf();
+        Q_SLOT void decodesSplitUtf8();
+        Q_SLOT void receivesLargeReply();
+};
+
+void AmcpConnectionTest::init()
+{
+    this->server = new QTcpServer(this);
+    QVERIFY(this->server->listen(QHostAddress::LocalHost));
+
+    this->connection = new AmcpConnection(this);
+    this->spy = new QSignalSpy(this->connection, SIGNAL(linesReceived(const QStringList&)));
+
+    QSignalSpy connectedSpy(this->connection, SIGNAL(connected()));
+    this->connection->connectToHost("127.0.0.1", this->server->serverPort());
+
+    QVERIFY(this->server->waitForNewConnection(5000));
+    this->peer = this->server->nextPendingConnection();
+    QVERIFY(this->peer != nullptr);
+    QTRY_COMPARE(connectedSpy.count(), 1);
+}
+
+void AmcpConnectionTest::cleanup()
+{
+    delete this->spy;
+    delete this->connection;
+    delete this->server;
+
+    this->spy = nullptr;
+    this->connection = nullptr;
+    this->server = nullptr;
+    this->peer = nullptr;
+}
+
+void AmcpConnectionTest::send(const QList<QByteArray>& chunks)
+{
+    // Give the client a chance to read every chunk on its own.
+    foreach (const QByteArray& chunk, chunks)
+    {
+        this->peer->write(chunk);
+        this->peer->flush();
+
+        QTest::qWait(20);
+    }
+}
+
+QStringList AmcpConnectionTest::receivedLines() const
+{
+    QStringList lines;
+    for (int i = 0; i < this->spy->count(); i++)
+        lines.append(this->spy->at(i).at(0).toStringList());
+
+    return lines;
+}
+
+void AmcpConnectionTest::splitsOnCrLf()
+{
+    send(QList<QByteArray>() << "201 VERSION OK\r\n2.3.0\r\n");
+
+    QTRY_COMPARE(receivedLines(), QStringList() << "201 VERSION OK" << "2.3.0");
+}
+
+void AmcpConnectionTest::joinsLinesAcrossReads()
+{
+    send(QList<QByteArray>() << "200 CLS O" << "K\r\n\"AMB\" MOVIE" << " 123\r" << "\n\r\n");
+
+    QTRY_COMPARE(receivedLines(), QStringList() << "200 CLS OK" << "\"AMB\" MOVIE 123" << "");
+}
+
+void AmcpConnectionTest::keepsBareLf()
+{
+    send(QList<QByteArray>() << "a\nb\r\n");
+
+    QTRY_COMPARE(receivedLines(), QStringList() << "a\nb");
+}
+
+void AmcpConnectionTest::decodesSplitUtf8()
+{
+    send(QList<QByteArray>() << "caf\xc3" << "\xa9\r\n");
+
+    QTRY_COMPARE(receivedLines(), QStringList() << QString::fromUtf8("caf\xc3\xa9"));
+}
+
+void AmcpConnectionTest::receivesLargeReply()
+{
+    const int count = 10000;
+
+    QByteArray reply("200 CLS OK\r\n");
+    for (int i = 0; i < count; i++)
+        reply.append(QString("\"CLIP%1\" MOVIE 123456 20260101000000 250 1/25\r\n").arg(i).toUtf8());
+
+    reply.append("\r\n");
+
+    QElapsedTimer timer;
+    timer.start();
+
+    send(QList<QByteArray>() << reply);
+
+    QTRY_COMPARE(receivedLines().count(), count + 2);
+    qDebug() << "Received" << count << "lines in" << timer.elapsed() << "ms";
+
+    const QStringList lines = receivedLines();
+    QCOMPARE(lines.first(), QString("200 CLS OK"));
+    QCOMPARE(lines.at(count), QString("\"CLIP%1\" MOVIE 123456 20260101000000 250 1/25").arg(count - 1));
+    QCOMPARE(lines.last(), QString(""));
+}
+
+QTEST_GUILESS_MAIN(AmcpConnectionTest)
+
+#include "AmcpConnectionTest.moc"
@@ -0,0 +1,141 @@
+#include "OscDeviceManager.h"
+#include "OscSubscription.h"
+
+#include <QtCore/QList>
+#include <QtCore/QMetaObject>
+#include <QtCore/QPointer>
+#include <QtCore/QString>
+#include <QtCore/QVariant>
+
+#include <QtTest/QtTest>
+
+class SubscriptionReceiver : public QObject
+{
+    Q_OBJECT
+
+    public:
+        int count = 0;
+
+        // Deleted by the first dispatch, except for the subscription being dispatched.
+        QList<QPointer<OscSubscription>> victims;
+
+        Q_SLOT void subscriptionReceived(const QString&, const QList<QVariant>&)
+        {
+            this->count++;
+
+            foreach (const QPointer<OscSubscription>& victim, this->victims)
+            {
+                if (!victim.isNull() && victim.data() != QObject::sender())
+                    delete victim.data();
+            }
+        }
+};
+
+class OscSubscriptionTest : public QObject
+{
+    Q_OBJECT
+
+    private:
+        void receive(const QString& path);
+        OscSubscription* subscribe(const QString& path, SubscriptionReceiver* receiver);
+
+        Q_SLOT void matchesFullPath();
+        Q_SLOT void matchesControlSuffix();
+        Q_SLOT void ignoresPartialSegment();
+        Q_SLOT void skipsDeletedSubscription();
+        Q_SLOT void skipsSubscriptionDeletedByHandler();
+        Q_SLOT void dispatchBenchmark();
+};
+
+void OscSubscriptionTest::receive(const QString& path)
+{
+    QMetaObject::invokeMethod(&OscDeviceManager::getInstance(), "messageReceived", Qt::DirectConnection,
+                              Q_ARG(QString, path), Q_ARG(QList<QVariant>, QList<QVariant>() << 1));
+}
+
+OscSubscription* OscSubscriptionTest::subscribe(const QString& path, SubscriptionReceiver* receiver)
+{
+    OscSubscription* subscription = new OscSubscription(path, receiver);
+    QObject::connect(subscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
+                     receiver, SLOT(subscriptionReceived(const QString&, const QList<QVariant>&)));
+
+    return subscription;
+}
+
+void OscSubscriptionTest::matchesFullPath()
+{
+    SubscriptionReceiver receiver;
+    subscribe("10.0.0.1/channel/1/stage/layer/10/file/path", &receiver);
+
+    receive("10.0.0.1/channel/1/stage/layer/10/file/path");
+    QCOMPARE(receiver.count, 1);
+
+    receive("10.0.0.1/channel/1/stage/layer/11/file/path");
+    QCOMPARE(receiver.count, 1);
+}
+
+void OscSubscriptionTest::matchesControlSuffix()
+{
+    SubscriptionReceiver receiver;
+    subscribe("/control/abc/stop", &receiver);
+
+    receive("/control/abc/stop");
+    QCOMPARE(receiver.count, 1);
+
+    receive("10.0.0.1/control/abc/stop");
+    QCOMPARE(receiver.count, 2);
+
+    receive("10.0.0.1/control/abcd/stop");
+    QCOMPARE(receiver.count, 2);
+}
+
+void OscSubscriptionTest::ignoresPartialSegment()
+{
+    SubscriptionReceiver receiver;
+    subscribe("10.0.0.1/channel/1/stage/layer/10/file/time", &receiver);
+
+    // Suffixes only start at a slash, the subscription must not match the tail of another address.
+    receive("110.0.0.1/channel/1/stage/layer/10/file/time");
+    QCOMPARE(receiver.count, 0);
+}
+
+void OscSubscriptionTest::skipsDeletedSubscription()
+{
+    SubscriptionReceiver receiver;
+    delete subscribe("/control/deleted/play", &receiver);
+
+    receive("10.0.0.1/control/deleted/play");
+    QCOMPARE(receiver.count, 0);
+}
+
+void OscSubscriptionTest::skipsSubscriptionDeletedByHandler()
+{
+    SubscriptionReceiver receiver;
+    receiver.victims.append(subscribe("/control/shared/play", &receiver));
+    receiver.victims.append(subscribe("/control/shared/play", &receiver));
+
+    // Whichever subscription is dispatched first deletes the other one.
+    receive("10.0.0.1/control/shared/play");
+    QCOMPARE(receiver.count, 1);
+
+    receive("10.0.0.1/control/shared/play");
+    QCOMPARE(receiver.count, 2);
+}
+
+void OscSubscriptionTest::dispatchBenchmark()
+{
+    SubscriptionReceiver receiver;
+    for (int i = 0; i < 1000; i++)
+        subscribe(QString("/control/item%1/stop").arg(i), &receiver);
+
+    QBENCHMARK
+    {
+        receive("10.0.0.1/control/item500/stop");
+    }
+
+    QVERIFY(receiver.count > 0);
+}
+
+QTEST_GUILESS_MAIN(OscSubscriptionTest)
+
+#include "OscSubscriptionTest.moc"
@@ -0,0 +1,16 @@
+QT -= gui
+QT += testlib
+
+CONFIG += c++11 testcase
+
+TARGET = tst_queues
+TEMPLATE = app
+
+SOURCES += \
+    QueuesTest.cpp
+
+unix:LIBS += -lpthread
+
+# The queues are header only.
+DEPENDPATH += $$PWD/../../Common
+INCLUDEPATH += $$PWD/../../Common
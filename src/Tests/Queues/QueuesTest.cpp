@@ -0,0 +1,234 @@
+#include "MpscQueue.h"
+#include "SpscQueue.h"
+
+#include <thread>
+#include <vector>
+
+#include <QtCore/QString>
+#include <QtTest/QtTest>
+
+class QueuesTest : public QObject
+{
+    Q_OBJECT
+
+    private:
+        Q_SLOT void spscKeepsOrder();
+        Q_SLOT void spscRoundsCapacityUp();
+        Q_SLOT void spscRejectsWhenFull();
+        Q_SLOT void spscAcrossThreads();
+        Q_SLOT void spscBenchmark();
+
+        Q_SLOT void mpscKeepsOrder();
+        Q_SLOT void mpscRejectsWhenFull();
+        Q_SLOT void mpscAcrossThreads();
+        Q_SLOT void mpscBenchmark();
+};
+
+void QueuesTest::spscKeepsOrder()
+{
+    SpscQueue<QString> queue(8);
+    QVERIFY(queue.isEmpty());
+
+    QVERIFY(queue.push("PLAY 1-10"));
+    QVERIFY(queue.push("STOP 1-10"));
+    QVERIFY(!queue.isEmpty());
+
+    QString value;
+    QVERIFY(queue.pop(value));
+    QCOMPARE(value, QString("PLAY 1-10"));
+    QVERIFY(queue.pop(value));
+    QCOMPARE(value, QString("STOP 1-10"));
+
+    QVERIFY(!queue.pop(value));
+    QVERIFY(queue.isEmpty());
+}
+
+void QueuesTest::spscRoundsCapacityUp()
+{
+    SpscQueue<int> queue(5);
+    for (int i = 0; i < 8; i++)
+        QVERIFY(queue.push(i));
+
+    QVERIFY(!queue.push(8));
+}
+
+void QueuesTest::spscRejectsWhenFull()
+{
+    SpscQueue<int> queue(4);
+    for (int i = 0; i < 4; i++)
+        QVERIFY(queue.push(i));
+
+    QVERIFY(!queue.push(4));
+
+    // The slot of a popped value is reused.
+    int value = -1;
+    QVERIFY(queue.pop(value));
+    QCOMPARE(value, 0);
+    QVERIFY(queue.push(4));
+
+    for (int i = 1; i <= 4; i++)
+    {
+        QVERIFY(queue.pop(value));
+        QCOMPARE(value, i);
+    }
+}
+
+void QueuesTest::spscAcrossThreads()
+{
+    const int count = 200000;
+
+    SpscQueue<int> queue(1024);
+    std::thread producer([&queue, count]()
+    {
+        for (int i = 0; i < count; i++)
+        {
+            while (!queue.push(i))
+                std::this_thread::yield();
+        }
+    });
+
+    int expected = 0;
+    bool ordered = true;
+    while (expected < count)
+    {
+        int value;
+        if (!queue.pop(value))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        if (value != expected)
+            ordered = false;
+
+        expected++;
+    }
+
+    producer.join();
+
+    QVERIFY(ordered);
+    QVERIFY(queue.isEmpty());
+}
+
+void QueuesTest::spscBenchmark()
+{
+    SpscQueue<QByteArray> queue(4096);
+    const QByteArray message("MIXER 1-10 OPACITY 0.5 25 linear DEFER\r\n");
+
+    QBENCHMARK
+    {
+        for (int i = 0; i < 4096; i++)
+            queue.push(message);
+
+        QByteArray value;
+        while (queue.pop(value))
+            ;
+    }
+}
+
+void QueuesTest::mpscKeepsOrder()
+{
+    MpscQueue<QString> queue(8);
+
+    QVERIFY(queue.push("first"));
+    QVERIFY(queue.push("second"));
+
+    QString value;
+    QVERIFY(queue.pop(value));
+    QCOMPARE(value, QString("first"));
+    QVERIFY(queue.pop(value));
+    QCOMPARE(value, QString("second"));
+
+    QVERIFY(!queue.pop(value));
+}
+
+void QueuesTest::mpscRejectsWhenFull()
+{
+    MpscQueue<int> queue(4);
+    for (int i = 0; i < 4; i++)
+        QVERIFY(queue.push(i));
+
+    QVERIFY(!queue.push(4));
+
+    int value = -1;
+    QVERIFY(queue.pop(value));
+    QCOMPARE(value, 0);
+    QVERIFY(queue.push(4));
+
+    for (int i = 1; i <= 4; i++)
+    {
+        QVERIFY(queue.pop(value));
+        QCOMPARE(value, i);
+    }
+
+    QVERIFY(!queue.pop(value));
+}
+
+void QueuesTest::mpscAcrossThreads()
+{
+    const int producerCount = 4;
+    const int count = 50000;
+
+    // Every value carries its producer and sequence number, the order must hold per producer.
+    MpscQueue<int> queue(1024);
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producerCount; producer++)
+    {
+        producers.push_back(std::thread([&queue, producer, count]()
+        {
+            for (int i = 0; i < count; i++)
+            {
+                while (!queue.push(producer * count + i))
+                    std::this_thread::yield();
+            }
+        }));
+    }
+
+    std::vector<int> next(producerCount, 0);
+    bool ordered = true;
+    int received = 0;
+    while (received < producerCount * count)
+    {
+        int value;
+        if (!queue.pop(value))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        int producer = value / count;
+        if (value % count != next[producer])
+            ordered = false;
+
+        next[producer]++;
+        received++;
+    }
+
+    for (size_t i = 0; i < producers.size(); i++)
+        producers[i].join();
+
+    QVERIFY(ordered);
+
+    int value;
+    QVERIFY(!queue.pop(value));
+}
+
+void QueuesTest::mpscBenchmark()
+{
+    MpscQueue<QString> queue(16384);
+    const QString line("[2026-01-01 00:00:00.000] [7f0c] [D] Sent message to 127.0.0.1:5250: PLAY 1-10 AMB\\r\\n");
+
+    QBENCHMARK
+    {
+        for (int i = 0; i < 16384; i++)
+            queue.push(line);
+
+        QString value;
+        while (queue.pop(value))
+            ;
+    }
+}
+
+QTEST_APPLESS_MAIN(QueuesTest)
+
+#include "QueuesTest.moc"
@@ -16,6 +16,7 @@ AudioMeterWidget::AudioMeterWidget(QWidget* parent)
     QObject::connect(&EventManager::getInstance(), SIGNAL(channelChanged(const ChannelChangedEvent&)), this, SLOT(channelChanged(const ChannelChangedEvent&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(emptyRundown(const EmptyRundownEvent&)), this, SLOT(emptyRundown(const EmptyRundownEvent&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(rundownItemSelected(const RundownItemSelectedEvent&)), this, SLOT(rundownItemSelected(const RundownItemSelectedEvent&)));
+    QObject::connect(&DeviceManager::getInstance(), SIGNAL(deviceAddressChanged(CasparDevice&)), this, SLOT(deviceAddressChanged(CasparDevice&)));
 }
 
 void AudioMeterWidget::configureAudioMeter(int channel)
@@ -37,6 +38,9 @@ void AudioMeterWidget::deviceChanged(const DeviceChangedEvent& event)
         if (DeviceManager::getInstance().getDeviceByName(event.getDeviceName()) == NULL)
             return;
 
+        if (DeviceManager::getInstance().getDeviceByName(event.getDeviceName())->resolveIpAddress().isEmpty())
+            return; // Subscribed when the address is resolved.
+
         this->progressBarAudioMeter->setValue(-61);
         this->progressBarAudioMeter->update();
 
@@ -78,6 +82,14 @@ void AudioMeterWidget::rundownItemSelected(const RundownItemSelectedEvent& event
     configureOscSubscriptions();
 }
 
+void AudioMeterWidget::deviceAddressChanged(CasparDevice& device)
+{
+    if (this->model == NULL || DeviceManager::getInstance().getDeviceByName(this->model->getDeviceName()).data() != &device)
+        return;
+
+    configureOscSubscriptions();
+}
+
 void AudioMeterWidget::configureOscSubscriptions()
 {
     if (this->audioSubscription != NULL)
@@ -89,6 +101,9 @@ void AudioMeterWidget::configureOscSubscriptions()
     if (DeviceManager::getInstance().getDeviceByName(this->model->getDeviceName()) == NULL)
         return;
 
+    if (DeviceManager::getInstance().getDeviceByName(this->model->getDeviceName())->resolveIpAddress().isEmpty())
+        return; // Subscribed when the address is resolved.
+
     QString audioFilter = Osc::DEFAULT_AUDIO_FILTER;
     audioFilter.replace("#IPADDRESS#", QString("%1").arg(DeviceManager::getInstance().getDeviceByName(this->model->getDeviceName())->resolveIpAddress()))
                .replace("#CHANNEL#", QString("%1").arg(this->command->getChannel()))
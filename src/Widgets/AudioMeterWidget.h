@@ -14,6 +14,8 @@
 
 #include <QtWidgets/QWidget>
 
+class CasparDevice;
+
 class WIDGETS_EXPORT AudioMeterWidget : public QWidget, Ui::AudioMeterWidget
 {
     Q_OBJECT
@@ -36,5 +38,6 @@ class WIDGETS_EXPORT AudioMeterWidget : public QWidget, Ui::AudioMeterWidget
         Q_SLOT void channelChanged(const ChannelChangedEvent&);
         Q_SLOT void emptyRundown(const EmptyRundownEvent&);
         Q_SLOT void rundownItemSelected(const RundownItemSelectedEvent&);
+        Q_SLOT void deviceAddressChanged(CasparDevice&);
         Q_SLOT void audioSubscriptionReceived(const QString&, const QList<QVariant>&);
 };
@@ -15,7 +15,6 @@ InspectorAtemAudioGainWidget::InspectorAtemAudioGainWidget(QWidget* parent)
 {
     setupUi(this);
 
-    QObject::connect(&EventManager::getInstance(), SIGNAL(rundownItemSelected(const RundownItemSelectedEvent&)), this, SLOT(rundownItemSelected(const RundownItemSelectedEvent&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(atemDeviceChanged(const AtemDeviceChangedEvent&)), this, SLOT(atemDeviceChanged(const AtemDeviceChangedEvent&)));
 }
 
@@ -14,8 +14,6 @@ InspectorAudioWidget::InspectorAudioWidget(QWidget* parent)
 {
     setupUi(this);
 
-    QObject::connect(&EventManager::getInstance(), SIGNAL(rundownItemSelected(const RundownItemSelectedEvent&)), this, SLOT(rundownItemSelected(const RundownItemSelectedEvent&)));
-
     loadDirection();
     loadTransition();
     loadTween();
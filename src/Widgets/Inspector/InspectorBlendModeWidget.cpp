@@ -15,8 +15,6 @@ InspectorBlendModeWidget::InspectorBlendModeWidget(QWidget* parent)
 {
     setupUi(this);
 
-    QObject::connect(&EventManager::getInstance(), SIGNAL(rundownItemSelected(const RundownItemSelectedEvent&)), this, SLOT(rundownItemSelected(const RundownItemSelectedEvent&)));
-
     loadBlendMode();
 }
 
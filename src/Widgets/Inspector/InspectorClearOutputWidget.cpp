@@ -16,8 +16,6 @@ InspectorClearOutputWidget::InspectorClearOutputWidget(QWidget* parent)
       model(NULL), command(NULL)
 {
     setupUi(this);
-
-    QObject::connect(&EventManager::getInstance(), SIGNAL(rundownItemSelected(const RundownItemSelectedEvent&)), this, SLOT(rundownItemSelected(const RundownItemSelectedEvent&)));
 }
 
 void InspectorClearOutputWidget::rundownItemSelected(const RundownItemSelectedEvent& event)
@@ -11,8 +11,6 @@ InspectorCustomCommandWidget::InspectorCustomCommandWidget(QWidget* parent)
       model(NULL), command(NULL)
 {
     setupUi(this);
-
-    QObject::connect(&EventManager::getInstance(), SIGNAL(rundownItemSelected(const RundownItemSelectedEvent&)), this, SLOT(rundownItemSelected(const RundownItemSelectedEvent&)));
 }
 
 void InspectorCustomCommandWidget::rundownItemSelected(const RundownItemSelectedEvent& event)
@@ -12,8 +12,6 @@ InspectorDeckLinkInputWidget::InspectorDeckLinkInputWidget(QWidget* parent)
 {
     setupUi(this);
 
-    QObject::connect(&EventManager::getInstance(), SIGNAL(rundownItemSelected(const RundownItemSelectedEvent&)), this, SLOT(rundownItemSelected(const RundownItemSelectedEvent&)));
-
     loadDirection();
     loadFormat();
     loadTransition();
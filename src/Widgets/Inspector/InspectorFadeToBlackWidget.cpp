@@ -16,8 +16,6 @@ InspectorFadeToBlackWidget::InspectorFadeToBlackWidget(QWidget* parent)
 {
     setupUi(this);
 
-    QObject::connect(&EventManager::getInstance(), SIGNAL(rundownItemSelected(const RundownItemSelectedEvent&)), this, SLOT(rundownItemSelected(const RundownItemSelectedEvent&)));
-
     loadDirection();
     loadTransition();
     loadTween();
@@ -11,8 +11,6 @@ InspectorFileRecorderWidget::InspectorFileRecorderWidget(QWidget* parent)
       model(NULL), command(NULL)
 {
     setupUi(this);
-
-    QObject::connect(&EventManager::getInstance(), SIGNAL(rundownItemSelected(const RundownItemSelectedEvent&)), this, SLOT(rundownItemSelected(const RundownItemSelectedEvent&)));
 }
 
 void InspectorFileRecorderWidget::rundownItemSelected(const RundownItemSelectedEvent& event)
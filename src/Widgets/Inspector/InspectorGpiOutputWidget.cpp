@@ -9,8 +9,6 @@ InspectorGpiOutputWidget::InspectorGpiOutputWidget(QWidget *parent)
       command(0)
 {
     setupUi(this);
-
-    QObject::connect(&EventManager::getInstance(), SIGNAL(rundownItemSelected(const RundownItemSelectedEvent&)), this, SLOT(rundownItemSelected(const RundownItemSelectedEvent&)));
 }
 
 void InspectorGpiOutputWidget::rundownItemSelected(const RundownItemSelectedEvent& event)
@@ -19,8 +19,6 @@ InspectorGroupWidget::InspectorGroupWidget(QWidget* parent)
     setupUi(this);
 
     this->enableOscInput = (DatabaseManager::getInstance().getConfigurationByName("EnableOscInput").getValue() == "true") ? true : false;
-
-    QObject::connect(&EventManager::getInstance(), SIGNAL(rundownItemSelected(const RundownItemSelectedEvent&)), this, SLOT(rundownItemSelected(const RundownItemSelectedEvent&)));
 }
 
 void InspectorGroupWidget::rundownItemSelected(const RundownItemSelectedEvent& event)
@@ -25,7 +25,6 @@ InspectorHttpGetWidget::InspectorHttpGetWidget(QWidget* parent)
     this->fieldCounter = this->treeWidgetHttpData->invisibleRootItem()->childCount();
 
     QObject::connect(&EventManager::getInstance(), SIGNAL(showAddHttpGetDataDialog(const ShowAddHttpGetDataDialogEvent&)), this, SLOT(showAddHttpGetDataDialog(const ShowAddHttpGetDataDialogEvent&)));
-    QObject::connect(&EventManager::getInstance(), SIGNAL(rundownItemSelected(const RundownItemSelectedEvent&)), this, SLOT(rundownItemSelected(const RundownItemSelectedEvent&)));
 
     this->treeWidgetHttpData->installEventFilter(this);
 }
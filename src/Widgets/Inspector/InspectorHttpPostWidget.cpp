@@ -25,7 +25,6 @@ InspectorHttpPostWidget::InspectorHttpPostWidget(QWidget* parent)
     this->fieldCounter = this->treeWidgetHttpData->invisibleRootItem()->childCount();
 
     QObject::connect(&EventManager::getInstance(), SIGNAL(showAddHttpPostDataDialog(const ShowAddHttpPostDataDialogEvent&)), this, SLOT(showAddHttpPostDataDialog(const ShowAddHttpPostDataDialogEvent&)));
-    QObject::connect(&EventManager::getInstance(), SIGNAL(rundownItemSelected(const RundownItemSelectedEvent&)), this, SLOT(rundownItemSelected(const RundownItemSelectedEvent&)));
 
     this->treeWidgetHttpData->installEventFilter(this);
 }
@@ -9,8 +9,6 @@ InspectorImageScrollerWidget::InspectorImageScrollerWidget(QWidget* parent)
       model(NULL), command(NULL)
 {
     setupUi(this);
-
-    QObject::connect(&EventManager::getInstance(), SIGNAL(rundownItemSelected(const RundownItemSelectedEvent&)), this, SLOT(rundownItemSelected(const RundownItemSelectedEvent&)));
 }
 
 void InspectorImageScrollerWidget::rundownItemSelected(const RundownItemSelectedEvent& event)
@@ -16,8 +16,6 @@ InspectorKeyerWidget::InspectorKeyerWidget(QWidget* parent)
       model(NULL), command(NULL)
 {
     setupUi(this);
-
-    QObject::connect(&EventManager::getInstance(), SIGNAL(rundownItemSelected(const RundownItemSelectedEvent&)), this, SLOT(rundownItemSelected(const RundownItemSelectedEvent&)));
 }
 
 void InspectorKeyerWidget::rundownItemSelected(const RundownItemSelectedEvent& event)
@@ -19,8 +19,6 @@ InspectorMovieWidget::InspectorMovieWidget(QWidget* parent)
 
     this->enableOscInput = (DatabaseManager::getInstance().getConfigurationByName("EnableOscInput").getValue() == "true") ? true : false;
 
-    QObject::connect(&EventManager::getInstance(), SIGNAL(rundownItemSelected(const RundownItemSelectedEvent&)), this, SLOT(rundownItemSelected(const RundownItemSelectedEvent&)));
-
     loadDirection();
     loadTransition();
     loadTween();
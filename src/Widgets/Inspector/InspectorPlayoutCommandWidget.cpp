@@ -12,8 +12,6 @@ InspectorPlayoutCommandWidget::InspectorPlayoutCommandWidget(QWidget* parent)
       model(NULL), command(NULL)
 {
     setupUi(this);
-
-    QObject::connect(&EventManager::getInstance(), SIGNAL(rundownItemSelected(const RundownItemSelectedEvent&)), this, SLOT(rundownItemSelected(const RundownItemSelectedEvent&)));
 }
 
 void InspectorPlayoutCommandWidget::rundownItemSelected(const RundownItemSelectedEvent& event)
@@ -11,8 +11,6 @@ InspectorPrintWidget::InspectorPrintWidget(QWidget* parent)
       model(NULL), command(NULL)
 {
     setupUi(this);
-
-    QObject::connect(&EventManager::getInstance(), SIGNAL(rundownItemSelected(const RundownItemSelectedEvent&)), this, SLOT(rundownItemSelected(const RundownItemSelectedEvent&)));
 }
 
 void InspectorPrintWidget::rundownItemSelected(const RundownItemSelectedEvent& event)
@@ -63,127 +63,81 @@
 
 #include "DeviceManager.h"
 #include "EventManager.h"
-#include "Commands/AbstractCommand.h"
-#include "Commands/BlendModeCommand.h"
-#include "Commands/BrightnessCommand.h"
-#include "Commands/CommitCommand.h"
-#include "Commands/ContrastCommand.h"
-#include "Commands/SolidColorCommand.h"
-#include "Commands/FadeToBlackCommand.h"
-#include "Commands/ClipCommand.h"
-#include "Commands/FillCommand.h"
-#include "Commands/GpiOutputCommand.h"
-#include "Commands/GridCommand.h"
-#include "Commands/GroupCommand.h"
-#include "Commands/KeyerCommand.h"
-#include "Commands/LevelsCommand.h"
-#include "Commands/MovieCommand.h"
-#include "Commands/OpacityCommand.h"
-#include "Commands/SaturationCommand.h"
-#include "Commands/TemplateCommand.h"
-#include "Commands/VolumeCommand.h"
-#include "Commands/DeckLinkInputCommand.h"
-#include "Commands/ImageScrollerCommand.h"
-#include "Commands/PlayoutCommand.h"
-#include "Commands/PrintCommand.h"
-#include "Commands/CustomCommand.h"
-#include "Commands/OscOutputCommand.h"
-#include "Commands/PerspectiveCommand.h"
-#include "Commands/RotationCommand.h"
-#include "Commands/AnchorCommand.h"
-#include "Commands/CropCommand.h"
-#include "Commands/HttpGetCommand.h"
-#include "Commands/HttpPostCommand.h"
-#include "Commands/HtmlCommand.h"
-#include "Commands/RouteChannelCommand.h"
-#include "Commands/RouteVideolayerCommand.h"
-#include "Commands/Atem/AtemInputCommand.h"
-#include "Commands/Atem/AtemCutCommand.h"
-#include "Commands/Atem/AtemAutoCommand.h"
-#include "Commands/Atem/AtemKeyerStateCommand.h"
-#include "Commands/Atem/AtemVideoFormatCommand.h"
-#include "Commands/Atem/AtemAudioInputStateCommand.h"
-#include "Commands/Atem/AtemAudioGainCommand.h"
-#include "Commands/Atem/AtemAudioInputBalanceCommand.h"
-#include "Commands/Atem/AtemMacroCommand.h"
-#include "Commands/TriCaster/InputCommand.h"
-#include "Commands/TriCaster/TakeCommand.h"
-#include "Commands/TriCaster/AutoCommand.h"
-#include "Commands/TriCaster/PresetCommand.h"
-#include "Commands/TriCaster/NetworkSourceCommand.h"
-#include "Commands/TriCaster/MacroCommand.h"
-#include "Commands/Panasonic/PanasonicPresetCommand.h"
-#include "Commands/Sony/SonyPresetCommand.h"
-#include "Commands/Spyder/SpyderPresetCommand.h"
+
+#include <QtCore/QMetaObject>
 
 InspectorWidget::InspectorWidget(QWidget* parent)
     : QWidget(parent),
-      masterVolumeMuted(false), disableCommand(false)
+      masterVolumeMuted(false), disableCommand(false), repositoryRundownActive(false), currentPanel(-1)
 {
     setupUi(this);
 
+    // Metadata and output are shown for every item, all other panels are created the first time an item of
+    // their type is selected.
     this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(0)), 0, new InspectorMetadataWidget(this));
     this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(1)), 0, new InspectorOutputWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(2)), 0, new InspectorTemplateWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(3)), 0, new InspectorMovieWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(4)), 0, new InspectorBlendModeWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(5)), 0, new InspectorBrightnessWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(6)), 0, new InspectorContrastWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(7)), 0, new InspectorClipWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(8)), 0, new InspectorFillWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(9)), 0, new InspectorGridWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(10)), 0, new InspectorLevelsWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(11)), 0, new InspectorOpacityWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(12)), 0, new InspectorSaturationWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(13)), 0, new InspectorVolumeWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(14)), 0, new InspectorDeckLinkInputWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(15)), 0, new InspectorGpiOutputWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(16)), 0, new InspectorImageScrollerWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(17)), 0, new InspectorFileRecorderWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(18)), 0, new InspectorKeyerWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(19)), 0, new InspectorPrintWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(20)), 0, new InspectorClearOutputWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(21)), 0, new InspectorGroupWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(22)), 0, new InspectorSolidColorWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(23)), 0, new InspectorAudioWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(24)), 0, new InspectorStillWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(25)), 0, new InspectorCustomCommandWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(26)), 0, new InspectorChromaWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(27)), 0, new InspectorInputWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(28)), 0, new InspectorTakeWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(29)), 0, new InspectorAutoWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(30)), 0, new InspectorPresetWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(31)), 0, new InspectorNetworkSourceWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(32)), 0, new InspectorMacroWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(33)), 0, new InspectorOscOutputWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(34)), 0, new InspectorAtemInputWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(35)), 0, new InspectorAtemCutWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(36)), 0, new InspectorAtemAutoWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(37)), 0, new InspectorAtemKeyerStateWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(38)), 0, new InspectorAtemVideoFormatWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(39)), 0, new InspectorAtemAudioInputStateWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(40)), 0, new InspectorAtemAudioGainWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(41)), 0, new InspectorAtemAudioInputBalanceWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(42)), 0, new InspectorPlayoutCommandWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(43)), 0, new InspectorFadeToBlackWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(44)), 0, new InspectorPanasonicPresetWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(45)), 0, new InspectorPerspectiveWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(46)), 0, new InspectorRotationWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(47)), 0, new InspectorAnchorWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(48)), 0, new InspectorCropWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(49)), 0, new InspectorHttpGetWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(50)), 0, new InspectorHttpPostWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(51)), 0, new InspectorHtmlWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(52)), 0, new InspectorRouteChannelWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(53)), 0, new InspectorRouteVideolayerWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(54)), 0, new InspectorSonyPresetWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(55)), 0, new InspectorSpyderPresetWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(56)), 0, new InspectorAtemMacroWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(57)), 0, new InspectorAtemFadeToBlackWidget(this));
+
+    this->panelIndexes.insert(Rundown::TEMPLATE, 2);
+    this->panelIndexes.insert(Rundown::MOVIE, 3);
+    this->panelIndexes.insert(Rundown::BLENDMODE, 4);
+    this->panelIndexes.insert(Rundown::BRIGHTNESS, 5);
+    this->panelIndexes.insert(Rundown::CONTRAST, 6);
+    this->panelIndexes.insert(Rundown::CLIP, 7);
+    this->panelIndexes.insert(Rundown::FILL, 8);
+    this->panelIndexes.insert(Rundown::GRID, 9);
+    this->panelIndexes.insert(Rundown::LEVELS, 10);
+    this->panelIndexes.insert(Rundown::OPACITY, 11);
+    this->panelIndexes.insert(Rundown::SATURATION, 12);
+    this->panelIndexes.insert(Rundown::VOLUME, 13);
+    this->panelIndexes.insert(Rundown::DECKLINKINPUT, 14);
+    this->panelIndexes.insert(Rundown::GPIOUTPUT, 15);
+    this->panelIndexes.insert(Rundown::IMAGESCROLLER, 16);
+    this->panelIndexes.insert(Rundown::FILERECORDER, 17);
+    this->panelIndexes.insert(Rundown::KEYER, 18);
+    this->panelIndexes.insert(Rundown::PRINT, 19);
+    this->panelIndexes.insert(Rundown::CLEAROUTPUT, 20);
+    this->panelIndexes.insert("GROUP", 21);
+    this->panelIndexes.insert(Rundown::SOLIDCOLOR, 22);
+    this->panelIndexes.insert(Rundown::AUDIO, 23);
+    this->panelIndexes.insert(Rundown::STILL, 24);
+    this->panelIndexes.insert(Rundown::CUSTOMCOMMAND, 25);
+    this->panelIndexes.insert(Rundown::CHROMAKEY, 26);
+    this->panelIndexes.insert(Rundown::TRICASTERINPUT, 27);
+    this->panelIndexes.insert(Rundown::TRICASTERTAKE, 28);
+    this->panelIndexes.insert(Rundown::TRICASTERAUTO, 29);
+    this->panelIndexes.insert(Rundown::TRICASTERPRESET, 30);
+    this->panelIndexes.insert(Rundown::TRICASTERNETSOURCE, 31);
+    this->panelIndexes.insert(Rundown::TRICASTERMACRO, 32);
+    this->panelIndexes.insert(Rundown::OSCOUTPUT, 33);
+    this->panelIndexes.insert(Rundown::ATEMINPUT, 34);
+    this->panelIndexes.insert(Rundown::ATEMCUT, 35);
+    this->panelIndexes.insert(Rundown::ATEMAUTO, 36);
+    this->panelIndexes.insert(Rundown::ATEMKEYERSTATE, 37);
+    this->panelIndexes.insert(Rundown::ATEMVIDEOFORMAT, 38);
+    this->panelIndexes.insert(Rundown::ATEMAUDIOINPUTSTATE, 39);
+    this->panelIndexes.insert(Rundown::ATEMAUDIOGAIN, 40);
+    this->panelIndexes.insert(Rundown::ATEMAUDIOINPUTBALANCE, 41);
+    this->panelIndexes.insert(Rundown::PLAYOUTCOMMAND, 42);
+    this->panelIndexes.insert(Rundown::FADETOBLACK, 43);
+    this->panelIndexes.insert(Rundown::PANASONICPRESET, 44);
+    this->panelIndexes.insert(Rundown::PERSPECTIVE, 45);
+    this->panelIndexes.insert(Rundown::ROTATION, 46);
+    this->panelIndexes.insert(Rundown::ANCHOR, 47);
+    this->panelIndexes.insert(Rundown::CROP, 48);
+    this->panelIndexes.insert(Rundown::HTTPGET, 49);
+    this->panelIndexes.insert(Rundown::HTTPPOST, 50);
+    this->panelIndexes.insert(Rundown::HTML, 51);
+    this->panelIndexes.insert(Rundown::ROUTECHANNEL, 52);
+    this->panelIndexes.insert(Rundown::ROUTEVIDEOLAYER, 53);
+    this->panelIndexes.insert(Rundown::SONYPRESET, 54);
+    this->panelIndexes.insert(Rundown::SPYDERPRESET, 55);
+    this->panelIndexes.insert(Rundown::ATEMMACRO, 56);
+    this->panelIndexes.insert(Rundown::ATEMFADETOBLACK, 57);
 
     this->treeWidgetInspector->expandAll();
 
-    setDefaultVisibleWidgets();
+    for (int i = 2; i < this->treeWidgetInspector->topLevelItemCount(); i++)
+        this->treeWidgetInspector->topLevelItem(i)->setHidden(true);
 
     QObject::connect(&EventManager::getInstance(), SIGNAL(rundownItemSelected(const RundownItemSelectedEvent&)), this, SLOT(rundownItemSelected(const RundownItemSelectedEvent&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(libraryItemSelected(const LibraryItemSelectedEvent&)), this, SLOT(libraryItemSelected(const LibraryItemSelectedEvent&)));
@@ -193,195 +147,125 @@ InspectorWidget::InspectorWidget(QWidget* parent)
 
 void InspectorWidget::repositoryRundown(const RepositoryRundownEvent& event)
 {
+    this->repositoryRundownActive = event.getRepositoryRundown();
+
     for (int i = 0; i < this->treeWidgetInspector->topLevelItemCount(); i++)
     {
         QTreeWidgetItem* item = this->treeWidgetInspector->topLevelItem(i);
-        QWidget* widget = this->treeWidgetInspector->itemWidget(item->child(0), 0);
+        if (item->childCount() == 0)
+            continue; // Not created yet.
+
+        this->treeWidgetInspector->itemWidget(item->child(0), 0)->setEnabled(!this->repositoryRundownActive);
+    }
+}
+
+QWidget* InspectorWidget::getPanel(int index)
+{
+    QTreeWidgetItem* item = this->treeWidgetInspector->topLevelItem(index);
+    if (item->childCount() > 0)
+        return this->treeWidgetInspector->itemWidget(item->child(0), 0);
+
+    QWidget* widget = createPanel(index);
+    widget->setEnabled(!this->repositoryRundownActive);
+
+    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(item), 0, widget);
+    item->setExpanded(true);
 
-        widget->setEnabled(!event.getRepositoryRundown());
+    return widget;
+}
+
+QWidget* InspectorWidget::createPanel(int index)
+{
+    switch (index)
+    {
+        case 2: return new InspectorTemplateWidget(this);
+        case 3: return new InspectorMovieWidget(this);
+        case 4: return new InspectorBlendModeWidget(this);
+        case 5: return new InspectorBrightnessWidget(this);
+        case 6: return new InspectorContrastWidget(this);
+        case 7: return new InspectorClipWidget(this);
+        case 8: return new InspectorFillWidget(this);
+        case 9: return new InspectorGridWidget(this);
+        case 10: return new InspectorLevelsWidget(this);
+        case 11: return new InspectorOpacityWidget(this);
+        case 12: return new InspectorSaturationWidget(this);
+        case 13: return new InspectorVolumeWidget(this);
+        case 14: return new InspectorDeckLinkInputWidget(this);
+        case 15: return new InspectorGpiOutputWidget(this);
+        case 16: return new InspectorImageScrollerWidget(this);
+        case 17: return new InspectorFileRecorderWidget(this);
+        case 18: return new InspectorKeyerWidget(this);
+        case 19: return new InspectorPrintWidget(this);
+        case 20: return new InspectorClearOutputWidget(this);
+        case 21: return new InspectorGroupWidget(this);
+        case 22: return new InspectorSolidColorWidget(this);
+        case 23: return new InspectorAudioWidget(this);
+        case 24: return new InspectorStillWidget(this);
+        case 25: return new InspectorCustomCommandWidget(this);
+        case 26: return new InspectorChromaWidget(this);
+        case 27: return new InspectorInputWidget(this);
+        case 28: return new InspectorTakeWidget(this);
+        case 29: return new InspectorAutoWidget(this);
+        case 30: return new InspectorPresetWidget(this);
+        case 31: return new InspectorNetworkSourceWidget(this);
+        case 32: return new InspectorMacroWidget(this);
+        case 33: return new InspectorOscOutputWidget(this);
+        case 34: return new InspectorAtemInputWidget(this);
+        case 35: return new InspectorAtemCutWidget(this);
+        case 36: return new InspectorAtemAutoWidget(this);
+        case 37: return new InspectorAtemKeyerStateWidget(this);
+        case 38: return new InspectorAtemVideoFormatWidget(this);
+        case 39: return new InspectorAtemAudioInputStateWidget(this);
+        case 40: return new InspectorAtemAudioGainWidget(this);
+        case 41: return new InspectorAtemAudioInputBalanceWidget(this);
+        case 42: return new InspectorPlayoutCommandWidget(this);
+        case 43: return new InspectorFadeToBlackWidget(this);
+        case 44: return new InspectorPanasonicPresetWidget(this);
+        case 45: return new InspectorPerspectiveWidget(this);
+        case 46: return new InspectorRotationWidget(this);
+        case 47: return new InspectorAnchorWidget(this);
+        case 48: return new InspectorCropWidget(this);
+        case 49: return new InspectorHttpGetWidget(this);
+        case 50: return new InspectorHttpPostWidget(this);
+        case 51: return new InspectorHtmlWidget(this);
+        case 52: return new InspectorRouteChannelWidget(this);
+        case 53: return new InspectorRouteVideolayerWidget(this);
+        case 54: return new InspectorSonyPresetWidget(this);
+        case 55: return new InspectorSpyderPresetWidget(this);
+        case 56: return new InspectorAtemMacroWidget(this);
+        case 57: return new InspectorAtemFadeToBlackWidget(this);
     }
+
+    return NULL;
 }
 
 void InspectorWidget::rundownItemSelected(const RundownItemSelectedEvent& event)
 {
-    setDefaultVisibleWidgets();
+    int index = -1;
+    if (event.getLibraryModel() != NULL)
+        index = this->panelIndexes.value(event.getLibraryModel()->getType(), -1);
 
-    if (dynamic_cast<TemplateCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(2)->setHidden(false);
-    else if (dynamic_cast<AudioCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(23)->setHidden(false);
-    else if (dynamic_cast<StillCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(24)->setHidden(false);
-    else if (dynamic_cast<MovieCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(3)->setHidden(false);
-    else if (dynamic_cast<BlendModeCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(4)->setHidden(false);
-    else if (dynamic_cast<BrightnessCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(5)->setHidden(false);
-    else if (dynamic_cast<ContrastCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(6)->setHidden(false);
-    else if (dynamic_cast<ClipCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(7)->setHidden(false);
-    else if (dynamic_cast<FillCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(8)->setHidden(false);
-    else if (dynamic_cast<GridCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(9)->setHidden(false);
-    else if (dynamic_cast<KeyerCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(18)->setHidden(false);
-    else if (dynamic_cast<CommitCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(1)->setHidden(false);
-    else if (dynamic_cast<LevelsCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(10)->setHidden(false);
-    else if (dynamic_cast<OpacityCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(11)->setHidden(false);
-    else if (dynamic_cast<SaturationCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(12)->setHidden(false);
-    else if (dynamic_cast<VolumeCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(13)->setHidden(false);
-    else if (dynamic_cast<GpiOutputCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(15)->setHidden(false);
-    else if (dynamic_cast<DeckLinkInputCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(14)->setHidden(false);
-    else if (dynamic_cast<ImageScrollerCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(16)->setHidden(false);
-    else if (dynamic_cast<FileRecorderCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(17)->setHidden(false);
-    else if (dynamic_cast<PrintCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(19)->setHidden(false);
-    else if (dynamic_cast<ClearOutputCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(20)->setHidden(false);
-    else if (dynamic_cast<SolidColorCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(22)->setHidden(false);
-    else if (dynamic_cast<GroupCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(21)->setHidden(false);
-    else if (dynamic_cast<CustomCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(25)->setHidden(false);
-    else if (dynamic_cast<ChromaCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(26)->setHidden(false);
-    else if (dynamic_cast<InputCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(27)->setHidden(false);
-    else if (dynamic_cast<TakeCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(28)->setHidden(false);
-    else if (dynamic_cast<AutoCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(29)->setHidden(false);
-    else if (dynamic_cast<PresetCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(30)->setHidden(false);
-    else if (dynamic_cast<NetworkSourceCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(31)->setHidden(false);
-    else if (dynamic_cast<MacroCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(32)->setHidden(false);
-    else if (dynamic_cast<OscOutputCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(33)->setHidden(false);
-    else if (dynamic_cast<AtemInputCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(34)->setHidden(false);
-    else if (dynamic_cast<AtemCutCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(35)->setHidden(false);
-    else if (dynamic_cast<AtemAutoCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(36)->setHidden(false);
-    else if (dynamic_cast<AtemKeyerStateCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(37)->setHidden(false);
-    else if (dynamic_cast<AtemVideoFormatCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(38)->setHidden(false);
-    else if (dynamic_cast<AtemAudioInputStateCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(39)->setHidden(false);
-    else if (dynamic_cast<AtemAudioGainCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(40)->setHidden(false);
-    else if (dynamic_cast<AtemAudioInputBalanceCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(41)->setHidden(false);
-    else if (dynamic_cast<PlayoutCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(42)->setHidden(false);
-    else if (dynamic_cast<FadeToBlackCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(43)->setHidden(false);
-    else if (dynamic_cast<PanasonicPresetCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(44)->setHidden(false);
-    else if (dynamic_cast<PerspectiveCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(45)->setHidden(false);
-    else if (dynamic_cast<RotationCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(46)->setHidden(false);
-    else if (dynamic_cast<AnchorCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(47)->setHidden(false);
-    else if (dynamic_cast<CropCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(48)->setHidden(false);
-    else if (dynamic_cast<HttpGetCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(49)->setHidden(false);
-    else if (dynamic_cast<HttpPostCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(50)->setHidden(false);
-    else if (dynamic_cast<HtmlCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(51)->setHidden(false);
-    else if (dynamic_cast<RouteChannelCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(52)->setHidden(false);
-    else if (dynamic_cast<RouteVideolayerCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(53)->setHidden(false);
-    else if (dynamic_cast<SonyPresetCommand*>(event.getCommand()))
-            this->treeWidgetInspector->topLevelItem(54)->setHidden(false);
-    else if (dynamic_cast<SpyderPresetCommand*>(event.getCommand()))
-            this->treeWidgetInspector->topLevelItem(55)->setHidden(false);
-    else if (dynamic_cast<AtemMacroCommand*>(event.getCommand()))
-            this->treeWidgetInspector->topLevelItem(56)->setHidden(false);
-    else if (dynamic_cast<AtemFadeToBlackCommand*>(event.getCommand()))
-            this->treeWidgetInspector->topLevelItem(57)->setHidden(false);
+    // The panel we leave still sees the event so it lets go of its command.
+    if (this->currentPanel != -1 && this->currentPanel != index)
+    {
+        QMetaObject::invokeMethod(getPanel(this->currentPanel), "rundownItemSelected", Qt::DirectConnection, Q_ARG(RundownItemSelectedEvent, event));
+        this->treeWidgetInspector->topLevelItem(this->currentPanel)->setHidden(true);
+    }
+
+    this->currentPanel = index;
+    if (this->currentPanel == -1)
+        return;
+
+    QMetaObject::invokeMethod(getPanel(this->currentPanel), "rundownItemSelected", Qt::DirectConnection, Q_ARG(RundownItemSelectedEvent, event));
+    this->treeWidgetInspector->topLevelItem(this->currentPanel)->setHidden(false);
 }
 
 void InspectorWidget::setDefaultVisibleWidgets()
 {
-    this->treeWidgetInspector->topLevelItem(0)->setHidden(false);
-    this->treeWidgetInspector->topLevelItem(1)->setHidden(false);
-    this->treeWidgetInspector->topLevelItem(2)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(3)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(4)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(5)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(6)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(7)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(8)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(9)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(10)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(11)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(12)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(13)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(14)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(15)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(16)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(17)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(18)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(19)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(20)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(21)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(22)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(23)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(24)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(25)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(26)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(27)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(28)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(29)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(30)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(31)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(32)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(33)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(34)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(35)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(36)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(37)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(38)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(39)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(40)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(41)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(42)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(43)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(44)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(45)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(46)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(47)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(48)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(49)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(50)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(51)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(52)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(53)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(54)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(55)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(56)->setHidden(true);
-    this->treeWidgetInspector->topLevelItem(57)->setHidden(true);
+    if (this->currentPanel != -1)
+        this->treeWidgetInspector->topLevelItem(this->currentPanel)->setHidden(true);
+
+    this->currentPanel = -1;
 }
 
 void InspectorWidget::emptyRundown(const EmptyRundownEvent& event)
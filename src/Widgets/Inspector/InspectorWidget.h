@@ -9,6 +9,7 @@
 #include "Events/Rundown/RepositoryRundownEvent.h"
 
 #include <QtCore/QEvent>
+#include <QtCore/QHash>
 #include <QtCore/QObject>
 
 #include <QtWidgets/QWidget>
@@ -23,7 +24,12 @@ class WIDGETS_EXPORT InspectorWidget : public QWidget, Ui::InspectorWidget
     private:
         bool masterVolumeMuted;
         bool disableCommand;
+        bool repositoryRundownActive;
+        int currentPanel;
+        QHash<QString, int> panelIndexes;
 
+        QWidget* getPanel(int index);
+        QWidget* createPanel(int index);
         void setDefaultVisibleWidgets();
 
         Q_SLOT void masterVolumeClicked();
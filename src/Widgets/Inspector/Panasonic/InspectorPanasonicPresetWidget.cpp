@@ -10,8 +10,6 @@ InspectorPanasonicPresetWidget::InspectorPanasonicPresetWidget(QWidget *parent)
       command(0)
 {
     setupUi(this);
-
-    QObject::connect(&EventManager::getInstance(), SIGNAL(rundownItemSelected(const RundownItemSelectedEvent&)), this, SLOT(rundownItemSelected(const RundownItemSelectedEvent&)));
 }
 
 void InspectorPanasonicPresetWidget::rundownItemSelected(const RundownItemSelectedEvent& event)
@@ -10,8 +10,6 @@ InspectorSonyPresetWidget::InspectorSonyPresetWidget(QWidget *parent)
       command(0)
 {
     setupUi(this);
-
-    QObject::connect(&EventManager::getInstance(), SIGNAL(rundownItemSelected(const RundownItemSelectedEvent&)), this, SLOT(rundownItemSelected(const RundownItemSelectedEvent&)));
 }
 
 void InspectorSonyPresetWidget::rundownItemSelected(const RundownItemSelectedEvent& event)
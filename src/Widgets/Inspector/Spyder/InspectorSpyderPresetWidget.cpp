@@ -10,8 +10,6 @@ InspectorSpyderPresetWidget::InspectorSpyderPresetWidget(QWidget *parent)
       command(0)
 {
     setupUi(this);
-
-    QObject::connect(&EventManager::getInstance(), SIGNAL(rundownItemSelected(const RundownItemSelectedEvent&)), this, SLOT(rundownItemSelected(const RundownItemSelectedEvent&)));
 }
 
 void InspectorSpyderPresetWidget::rundownItemSelected(const RundownItemSelectedEvent& event)
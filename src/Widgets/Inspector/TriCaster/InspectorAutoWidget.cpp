@@ -16,8 +16,6 @@ InspectorAutoWidget::InspectorAutoWidget(QWidget* parent)
 {
     setupUi(this);
 
-    QObject::connect(&EventManager::getInstance(), SIGNAL(rundownItemSelected(const RundownItemSelectedEvent&)), this, SLOT(rundownItemSelected(const RundownItemSelectedEvent&)));
-
     loadTriCasterStep();
     loadTriCasterAutoSpeed();
     loadTriCasterAutoTransition();
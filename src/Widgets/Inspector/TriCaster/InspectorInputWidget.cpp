@@ -15,8 +15,6 @@ InspectorInputWidget::InspectorInputWidget(QWidget* parent)
 {
     setupUi(this);
 
-    QObject::connect(&EventManager::getInstance(), SIGNAL(rundownItemSelected(const RundownItemSelectedEvent&)), this, SLOT(rundownItemSelected(const RundownItemSelectedEvent&)));
-
     loadTriCasterSwitcher();
     loadTriCasterInput();
 }
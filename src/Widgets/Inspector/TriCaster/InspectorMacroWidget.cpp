@@ -13,8 +13,6 @@ InspectorMacroWidget::InspectorMacroWidget(QWidget* parent)
       model(NULL), command(NULL)
 {
     setupUi(this);
-
-    QObject::connect(&EventManager::getInstance(), SIGNAL(rundownItemSelected(const RundownItemSelectedEvent&)), this, SLOT(rundownItemSelected(const RundownItemSelectedEvent&)));
 }
 
 void InspectorMacroWidget::rundownItemSelected(const RundownItemSelectedEvent& event)
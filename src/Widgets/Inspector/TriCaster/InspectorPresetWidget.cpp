@@ -14,8 +14,6 @@ InspectorPresetWidget::InspectorPresetWidget(QWidget* parent)
 {
     setupUi(this);
 
-    QObject::connect(&EventManager::getInstance(), SIGNAL(rundownItemSelected(const RundownItemSelectedEvent&)), this, SLOT(rundownItemSelected(const RundownItemSelectedEvent&)));
-
     loadTriCasterSource();
     loadTriCasterPreset();
 }
@@ -215,6 +215,9 @@ void MainWindow::statusbar(const StatusbarEvent& event)
         return;
 
     this->statusBar()->showMessage(event.getMessage(), event.getTimeout());
+
+    // Paint now, the message may be sent while the GUI thread is busy, e.g. while a rundown is read.
+    this->statusBar()->repaint();
 }
 
 void MainWindow::activeRundownChanged(const ActiveRundownChangedEvent& event)
@@ -4,6 +4,7 @@
 
 #include "DatabaseManager.h"
 #include "EventManager.h"
+#include "ThumbnailStore.h"
 #include "Models/LibraryModel.h"
 #include "Models/ThumbnailModel.h"
 
@@ -11,7 +12,7 @@
 
 PreviewWidget::PreviewWidget(QWidget* parent)
     : QWidget(parent),
-      viewAlpha(false), collapsed(false)
+      viewAlpha(false), collapsed(false), model(NULL)
 {
     setupUi(this);
     setupMenus();
@@ -19,6 +20,9 @@ PreviewWidget::PreviewWidget(QWidget* parent)
     QObject::connect(&EventManager::getInstance(), SIGNAL(libraryItemSelected(const LibraryItemSelectedEvent&)), this, SLOT(libraryItemSelected(const LibraryItemSelectedEvent&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(rundownItemSelected(const RundownItemSelectedEvent&)), this, SLOT(rundownItemSelected(const RundownItemSelectedEvent&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(targetChanged(const TargetChangedEvent&)), this, SLOT(targetChanged(const TargetChangedEvent&)));
+    QObject::connect(&EventManager::getInstance(), SIGNAL(thumbnailChanged(const ThumbnailChangedEvent&)), this, SLOT(thumbnailChanged(const ThumbnailChangedEvent&)));
+    QObject::connect(&ThumbnailStore::getInstance(), SIGNAL(thumbnailDecoded(const QString&)), this, SLOT(thumbnailDecoded(const QString&)));
+    QObject::connect(&ThumbnailStore::getInstance(), SIGNAL(thumbnailFailed(const QString&)), this, SLOT(thumbnailFailed(const QString&)));
 }
 
 void PreviewWidget::setupMenus()
@@ -61,10 +65,31 @@ void PreviewWidget::rundownItemSelected(const RundownItemSelectedEvent& event)
     setThumbnail();
 }
 
+void PreviewWidget::thumbnailChanged(const ThumbnailChangedEvent& event)
+{
+    if (this->model == NULL || event.getDeviceName() != this->model->getDeviceName() || !event.getNames().contains(this->model->getName()))
+        return;
+
+    setThumbnail();
+}
+
+void PreviewWidget::thumbnailDecoded(const QString& key)
+{
+    if (key == this->thumbnailKey)
+        setThumbnail();
+}
+
+void PreviewWidget::thumbnailFailed(const QString& key)
+{
+    if (key == this->thumbnailKey)
+        EventManager::getInstance().fireThumbnailRequestedEvent(ThumbnailRequestedEvent(this->model->getDeviceName(), this->model->getName()));
+}
+
 void PreviewWidget::setThumbnail()
 {
     if (this->model->getType() != Rundown::STILL && this->model->getType() != Rundown::MOVIE)
     {
+        this->thumbnailKey.clear();
         this->labelPreview->clear();
         return;
     }
@@ -73,26 +98,33 @@ void PreviewWidget::setThumbnail()
     QString name = this->model->getName();
     QString deviceName = this->model->getDeviceName();
 
-    QString data = DatabaseManager::getInstance().getThumbnailByNameAndDeviceName(name, deviceName).getData();
+    QString key = DatabaseManager::getInstance().getThumbnailByNameAndDeviceName(name, deviceName).getData();
 
     /*
-    QString data = DatabaseManager::getInstance().getThumbnailById(thumbnailId).getData();
-    if (data.isEmpty())
-        data = DatabaseManager::getInstance().getThumbnailByNameAndDeviceName(name, deviceName).getData();
+    QString key = DatabaseManager::getInstance().getThumbnailById(thumbnailId).getData();
+    if (key.isEmpty())
+        key = DatabaseManager::getInstance().getThumbnailByNameAndDeviceName(name, deviceName).getData();
     */
 
-    if (!data.isEmpty())
+    // Stays empty until the thumbnail is decoded.
+    this->thumbnailKey = key;
+
+    QPixmap pixmap = ThumbnailStore::getInstance().getPixmap(key);
+    if (!pixmap.isNull())
     {
-        this->image.loadFromData(QByteArray::fromBase64(data.toLatin1()), "PNG");
+        this->image = pixmap.toImage();
 
         if (this->viewAlpha)
             this->labelPreview->setPixmap(QPixmap::fromImage(this->image.alphaChannel()));
         else
-            this->labelPreview->setPixmap(QPixmap::fromImage(this->image));
+            this->labelPreview->setPixmap(pixmap);
     }
     else
     {
         this->labelPreview->clear();
+
+        if (key.isEmpty() || ThumbnailStore::getInstance().hasFailed(key))
+            EventManager::getInstance().fireThumbnailRequestedEvent(ThumbnailRequestedEvent(deviceName, name));
     }
 }
 
@@ -3,6 +3,7 @@
 #include "Shared.h"
 #include "ui_PreviewWidget.h"
 
+#include "Events/ThumbnailChangedEvent.h"
 #include "Events/Inspector/TargetChangedEvent.h"
 #include "Events/Library/LibraryItemSelectedEvent.h"
 #include "Events/Rundown/RundownItemSelectedEvent.h"
@@ -25,6 +26,7 @@ class WIDGETS_EXPORT PreviewWidget : public QWidget, Ui::PreviewWidget
         bool viewAlpha;
         bool collapsed;
         QImage image;
+        QString thumbnailKey;
         LibraryModel* model;
 
         QMenu* contextMenuPreviewDropdown;
@@ -40,4 +42,7 @@ class WIDGETS_EXPORT PreviewWidget : public QWidget, Ui::PreviewWidget
         Q_SLOT void targetChanged(const TargetChangedEvent&);
         Q_SLOT void libraryItemSelected(const LibraryItemSelectedEvent&);
         Q_SLOT void rundownItemSelected(const RundownItemSelectedEvent&);
+        Q_SLOT void thumbnailChanged(const ThumbnailChangedEvent&);
+        Q_SLOT void thumbnailDecoded(const QString&);
+        Q_SLOT void thumbnailFailed(const QString&);
 };
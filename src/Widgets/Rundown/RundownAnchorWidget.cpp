@@ -52,8 +52,6 @@ RundownAnchorWidget::RundownAnchorWidget(const LibraryModel& model, QWidget* par
     QObject::connect(&this->command, SIGNAL(allowGpiChanged(bool)), this, SLOT(allowGpiChanged(bool)));
     QObject::connect(&this->command, SIGNAL(remoteTriggerIdChanged(const QString&)), this, SLOT(remoteTriggerIdChanged(const QString&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(preview(const PreviewEvent&)), this, SLOT(preview(const PreviewEvent&)));
-    QObject::connect(&EventManager::getInstance(), SIGNAL(deviceChanged(const DeviceChangedEvent&)), this, SLOT(deviceChanged(const DeviceChangedEvent&)));
-    QObject::connect(&EventManager::getInstance(), SIGNAL(labelChanged(const LabelChangedEvent&)), this, SLOT(labelChanged(const LabelChangedEvent&)));
 
     QObject::connect(&DeviceManager::getInstance(), SIGNAL(deviceAdded(CasparDevice&)), this, SLOT(deviceAdded(CasparDevice&)));
     const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
@@ -311,38 +309,15 @@ void RundownAnchorWidget::executeStop()
 {
     this->executeTimer.stop();
 
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-        device->setAnchor(this->command.getChannel(), this->command.getVideolayer(), 0, 0);
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-            deviceShadow->setAnchor(this->command.getChannel(), this->command.getVideolayer(), 0, 0);
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    device->setAnchor(this->command.getChannel(), this->command.getVideolayer(), 0, 0);
 }
 
 void RundownAnchorWidget::executePlay()
 {
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-        device->setAnchor(this->command.getChannel(), this->command.getVideolayer(), this->command.getPositionX(),
-                          this->command.getPositionY(), this->command.getTransitionDuration(), this->command.getTween(), this->command.getDefer());
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice>  deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-            deviceShadow->setAnchor(this->command.getChannel(), this->command.getVideolayer(), this->command.getPositionX(),
-                                    this->command.getPositionY(), this->command.getTransitionDuration(), this->command.getTween(), this->command.getDefer());
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    device->setAnchor(this->command.getChannel(), this->command.getVideolayer(), this->command.getPositionX(),
+                      this->command.getPositionY(), this->command.getTransitionDuration(), this->command.getTween(), this->command.getDefer());
 
     if (this->markUsedItems)
         setUsed(true);
@@ -352,44 +327,17 @@ void RundownAnchorWidget::executeClearVideolayer()
 {
     this->executeTimer.stop();
 
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-        device->clearMixerVideolayer(this->command.getChannel(), this->command.getVideolayer());
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-            deviceShadow->clearMixerVideolayer(this->command.getChannel(), this->command.getVideolayer());
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    device->clearMixerVideolayer(this->command.getChannel(), this->command.getVideolayer());
 }
 
 void RundownAnchorWidget::executeClearChannel()
 {
     this->executeTimer.stop();
 
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-    {
-        device->clearChannel(this->command.getChannel());
-        device->clearMixerChannel(this->command.getChannel());
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            deviceShadow->clearChannel(this->command.getChannel());
-            deviceShadow->clearMixerChannel(this->command.getChannel());
-        }
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    device->clearChannel(this->command.getChannel());
+    device->clearMixerChannel(this->command.getChannel());
 }
 
 void RundownAnchorWidget::channelChanged(int channel)
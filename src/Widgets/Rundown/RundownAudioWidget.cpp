@@ -59,9 +59,6 @@ RundownAudioWidget::RundownAudioWidget(const LibraryModel& model, QWidget* paren
     QObject::connect(&this->command, SIGNAL(allowGpiChanged(bool)), this, SLOT(allowGpiChanged(bool)));
     QObject::connect(&this->command, SIGNAL(loopChanged(bool)), this, SLOT(loopChanged(bool)));
     QObject::connect(&this->command, SIGNAL(remoteTriggerIdChanged(const QString&)), this, SLOT(remoteTriggerIdChanged(const QString&)));
-    QObject::connect(&EventManager::getInstance(), SIGNAL(deviceChanged(const DeviceChangedEvent&)), this, SLOT(deviceChanged(const DeviceChangedEvent&)));
-    QObject::connect(&EventManager::getInstance(), SIGNAL(targetChanged(const TargetChangedEvent&)), this, SLOT(targetChanged(const TargetChangedEvent&)));
-    QObject::connect(&EventManager::getInstance(), SIGNAL(labelChanged(const LabelChangedEvent&)), this, SLOT(labelChanged(const LabelChangedEvent&)));
 
     QObject::connect(&DeviceManager::getInstance(), SIGNAL(deviceAdded(CasparDevice&)), this, SLOT(deviceAdded(CasparDevice&)));
     const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
@@ -339,19 +336,8 @@ void RundownAudioWidget::executeStop()
     this->executeStartTimer.stop();
     this->executeStopTimer.stop();
 
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-        device->stop(this->command.getChannel(), this->command.getVideolayer());
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-            deviceShadow->stop(this->command.getChannel(), this->command.getVideolayer());
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    device->stop(this->command.getChannel(), this->command.getVideolayer());
 
     this->paused = false;
     this->loaded = false;
@@ -360,40 +346,16 @@ void RundownAudioWidget::executeStop()
 
 void RundownAudioWidget::executePlay()
 {
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    if (this->loaded)
     {
-        if (this->loaded)
-        {
-            device->play(this->command.getChannel(), this->command.getVideolayer());
-        }
-        else
-        {
-            device->playAudio(this->command.getChannel(), this->command.getVideolayer(), this->command.getAudioName(),
-                              this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                              this->command.getDirection(), this->command.getLoop(), this->command.getUseAuto());
-        }
+        device->play(this->command.getChannel(), this->command.getVideolayer());
     }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+    else
     {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice>  deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            if (this->loaded)
-            {
-                deviceShadow->play(this->command.getChannel(), this->command.getVideolayer());
-            }
-            else
-            {
-                deviceShadow->playAudio(this->command.getChannel(), this->command.getVideolayer(), this->command.getAudioName(),
-                                        this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                                        this->command.getDirection(), this->command.getLoop(), this->command.getUseAuto());
-            }
-        }
+        device->playAudio(this->command.getChannel(), this->command.getVideolayer(), this->command.getAudioName(),
+                          this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
+                          this->command.getDirection(), this->command.getLoop(), this->command.getUseAuto());
     }
 
     if (this->markUsedItems)
@@ -409,56 +371,21 @@ void RundownAudioWidget::executePause()
     if (!this->playing)
         return;
 
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-    {
-        if (this->paused)
-            device->resume(this->command.getChannel(), this->command.getVideolayer());
-        else
-            device->pause(this->command.getChannel(), this->command.getVideolayer());
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            if (this->paused)
-                deviceShadow->resume(this->command.getChannel(), this->command.getVideolayer());
-            else
-                deviceShadow->pause(this->command.getChannel(), this->command.getVideolayer());
-        }
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    if (this->paused)
+        device->resume(this->command.getChannel(), this->command.getVideolayer());
+    else
+        device->pause(this->command.getChannel(), this->command.getVideolayer());
 
     this->paused = !this->paused;
 }
 
 void RundownAudioWidget::executeLoad()
 {
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-    {
-        device->loadAudio(this->command.getChannel(), this->command.getVideolayer(), this->command.getAudioName(),
-                          this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                          this->command.getDirection(), this->command.getLoop(), this->command.getUseAuto());
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice>  deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            deviceShadow->loadAudio(this->command.getChannel(), this->command.getVideolayer(), this->command.getAudioName(),
-                                    this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                                    this->command.getDirection(), this->command.getLoop(), this->command.getUseAuto());
-        }
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    device->loadAudio(this->command.getChannel(), this->command.getVideolayer(), this->command.getAudioName(),
+                      this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
+                      this->command.getDirection(), this->command.getLoop(), this->command.getUseAuto());
 
     this->loaded = true;
     this->paused = false;
@@ -470,19 +397,8 @@ void RundownAudioWidget::executeClearVideolayer()
     this->executeStartTimer.stop();
     this->executeStopTimer.stop();
 
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-        device->clearVideolayer(this->command.getChannel(), this->command.getVideolayer());
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-            deviceShadow->clearVideolayer(this->command.getChannel(), this->command.getVideolayer());
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    device->clearVideolayer(this->command.getChannel(), this->command.getVideolayer());
 
     this->paused = false;
     this->loaded = false;
@@ -494,25 +410,9 @@ void RundownAudioWidget::executeClearChannel()
     this->executeStartTimer.stop();
     this->executeStopTimer.stop();
 
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-    {
-        device->clearChannel(this->command.getChannel());
-        device->clearMixerChannel(this->command.getChannel());
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            deviceShadow->clearChannel(this->command.getChannel());
-            deviceShadow->clearMixerChannel(this->command.getChannel());
-        }
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    device->clearChannel(this->command.getChannel());
+    device->clearMixerChannel(this->command.getChannel());
 
     this->paused = false;
     this->loaded = false;
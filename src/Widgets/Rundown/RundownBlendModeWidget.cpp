@@ -52,8 +52,6 @@ RundownBlendModeWidget::RundownBlendModeWidget(const LibraryModel& model, QWidge
     QObject::connect(&this->command, SIGNAL(allowGpiChanged(bool)), this, SLOT(allowGpiChanged(bool)));
     QObject::connect(&this->command, SIGNAL(remoteTriggerIdChanged(const QString&)), this, SLOT(remoteTriggerIdChanged(const QString&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(preview(const PreviewEvent&)), this, SLOT(preview(const PreviewEvent&)));
-    QObject::connect(&EventManager::getInstance(), SIGNAL(deviceChanged(const DeviceChangedEvent&)), this, SLOT(deviceChanged(const DeviceChangedEvent&)));
-    QObject::connect(&EventManager::getInstance(), SIGNAL(labelChanged(const LabelChangedEvent&)), this, SLOT(labelChanged(const LabelChangedEvent&)));
 
     QObject::connect(&DeviceManager::getInstance(), SIGNAL(deviceAdded(CasparDevice&)), this, SLOT(deviceAdded(CasparDevice&)));
     const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
@@ -304,36 +302,14 @@ void RundownBlendModeWidget::executeStop()
 {
     this->executeTimer.stop();
 
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-        device->setBlendMode(this->command.getChannel(), this->command.getVideolayer(), "Normal");
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-            deviceShadow->setBlendMode(this->command.getChannel(), this->command.getVideolayer(), "Normal");
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    device->setBlendMode(this->command.getChannel(), this->command.getVideolayer(), "Normal");
 }
 
 void RundownBlendModeWidget::executePlay()
 {
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-        device->setBlendMode(this->command.getChannel(), this->command.getVideolayer(), this->command.getBlendMode());
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice>  deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-            deviceShadow->setBlendMode(this->command.getChannel(), this->command.getVideolayer(), this->command.getBlendMode());
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    device->setBlendMode(this->command.getChannel(), this->command.getVideolayer(), this->command.getBlendMode());
 
     if (this->markUsedItems)
         setUsed(true);
@@ -343,44 +319,17 @@ void RundownBlendModeWidget::executeClearVideolayer()
 {
     this->executeTimer.stop();
 
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-        device->clearMixerVideolayer(this->command.getChannel(), this->command.getVideolayer());
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-            deviceShadow->clearMixerVideolayer(this->command.getChannel(), this->command.getVideolayer());
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    device->clearMixerVideolayer(this->command.getChannel(), this->command.getVideolayer());
 }
 
 void RundownBlendModeWidget::executeClearChannel()
 {
     this->executeTimer.stop();
 
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-    {
-        device->clearChannel(this->command.getChannel());
-        device->clearMixerChannel(this->command.getChannel());
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            deviceShadow->clearChannel(this->command.getChannel());
-            deviceShadow->clearMixerChannel(this->command.getChannel());
-        }
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    device->clearChannel(this->command.getChannel());
+    device->clearMixerChannel(this->command.getChannel());
 }
 
 void RundownBlendModeWidget::channelChanged(int channel)
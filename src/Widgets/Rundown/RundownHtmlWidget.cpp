@@ -50,8 +50,6 @@ RundownHtmlWidget::RundownHtmlWidget(const LibraryModel& model, QWidget* parent,
     QObject::connect(&this->command, SIGNAL(delayChanged(int)), this, SLOT(delayChanged(int)));
     QObject::connect(&this->command, SIGNAL(allowGpiChanged(bool)), this, SLOT(allowGpiChanged(bool)));
     QObject::connect(&this->command, SIGNAL(remoteTriggerIdChanged(const QString&)), this, SLOT(remoteTriggerIdChanged(const QString&)));
-    QObject::connect(&EventManager::getInstance(), SIGNAL(deviceChanged(const DeviceChangedEvent&)), this, SLOT(deviceChanged(const DeviceChangedEvent&)));
-    QObject::connect(&EventManager::getInstance(), SIGNAL(labelChanged(const LabelChangedEvent&)), this, SLOT(labelChanged(const LabelChangedEvent&)));
 
     QObject::connect(&DeviceManager::getInstance(), SIGNAL(deviceAdded(CasparDevice&)), this, SLOT(deviceAdded(CasparDevice&)));
     const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
@@ -353,40 +351,16 @@ void RundownHtmlWidget::executeStop()
 
 void RundownHtmlWidget::executePlay()
 {
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    if (this->loaded)
     {
-        if (this->loaded)
-        {
-            device->play(this->command.getChannel(), this->command.getVideolayer());
-        }
-        else
-        {
-            device->playHtml(this->command.getChannel(), this->command.getVideolayer(), this->command.getUrl(),
-                             this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                             this->command.getDirection(), this->command.getUseAuto());
-        }
+        device->play(this->command.getChannel(), this->command.getVideolayer());
     }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+    else
     {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice>  deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            if (this->loaded)
-            {
-                deviceShadow->play(this->command.getChannel(), this->command.getVideolayer());
-            }
-            else
-            {
-                deviceShadow->playHtml(this->command.getChannel(), this->command.getVideolayer(), this->command.getUrl(),
-                                       this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                                       this->command.getDirection(), this->command.getUseAuto());
-            }
-        }
+        device->playHtml(this->command.getChannel(), this->command.getVideolayer(), this->command.getUrl(),
+                         this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
+                         this->command.getDirection(), this->command.getUseAuto());
     }
 
     if (this->markUsedItems)
@@ -402,56 +376,21 @@ void RundownHtmlWidget::executePause()
     if (!this->playing)
         return;
 
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-    {
-        if (this->paused)
-            device->resume(this->command.getChannel(), this->command.getVideolayer());
-        else
-            device->pause(this->command.getChannel(), this->command.getVideolayer());
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            if (this->paused)
-                deviceShadow->resume(this->command.getChannel(), this->command.getVideolayer());
-            else
-                deviceShadow->pause(this->command.getChannel(), this->command.getVideolayer());
-        }
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    if (this->paused)
+        device->resume(this->command.getChannel(), this->command.getVideolayer());
+    else
+        device->pause(this->command.getChannel(), this->command.getVideolayer());
 
     this->paused = !this->paused;
 }
 
 void RundownHtmlWidget::executeLoad()
 {
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-    {
-        device->loadHtml(this->command.getChannel(), this->command.getVideolayer(), this->command.getUrl(),
-                            this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                            this->command.getDirection(), this->command.getFreezeOnLoad(), this->command.getUseAuto());
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice>  deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            deviceShadow->loadHtml(this->command.getChannel(), this->command.getVideolayer(), this->command.getUrl(),
-                                      this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                                      this->command.getDirection(), this->command.getFreezeOnLoad(), this->command.getUseAuto());
-        }
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    device->loadHtml(this->command.getChannel(), this->command.getVideolayer(), this->command.getUrl(),
+                        this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
+                        this->command.getDirection(), this->command.getFreezeOnLoad(), this->command.getUseAuto());
 
     this->loaded = true;
     this->paused = false;
@@ -5,6 +5,7 @@
 #include "DatabaseManager.h"
 #include "DeviceManager.h"
 #include "GpiManager.h"
+#include "ThumbnailStore.h"
 #include "EventManager.h"
 #include "Events/ConnectionStateChangedEvent.h"
 
@@ -12,6 +13,7 @@
 
 #include <QtCore/QObject>
 #include <QtCore/QTimer>
+#include <QtCore/QUrl>
 
 #include <QtWidgets/QGraphicsOpacityEffect>
 
@@ -56,9 +58,9 @@ RundownImageScrollerWidget::RundownImageScrollerWidget(const LibraryModel& model
     QObject::connect(&this->command, SIGNAL(delayChanged(int)), this, SLOT(delayChanged(int)));
     QObject::connect(&this->command, SIGNAL(allowGpiChanged(bool)), this, SLOT(allowGpiChanged(bool)));
     QObject::connect(&this->command, SIGNAL(remoteTriggerIdChanged(const QString&)), this, SLOT(remoteTriggerIdChanged(const QString&)));
-    QObject::connect(&EventManager::getInstance(), SIGNAL(deviceChanged(const DeviceChangedEvent&)), this, SLOT(deviceChanged(const DeviceChangedEvent&)));
-    QObject::connect(&EventManager::getInstance(), SIGNAL(targetChanged(const TargetChangedEvent&)), this, SLOT(targetChanged(const TargetChangedEvent&)));
-    QObject::connect(&EventManager::getInstance(), SIGNAL(labelChanged(const LabelChangedEvent&)), this, SLOT(labelChanged(const LabelChangedEvent&)));
+    QObject::connect(&EventManager::getInstance(), SIGNAL(thumbnailChanged(const ThumbnailChangedEvent&)), this, SLOT(thumbnailChanged(const ThumbnailChangedEvent&)));
+    QObject::connect(&ThumbnailStore::getInstance(), SIGNAL(thumbnailDecoded(const QString&)), this, SLOT(thumbnailDecoded(const QString&)));
+    QObject::connect(&ThumbnailStore::getInstance(), SIGNAL(thumbnailFailed(const QString&)), this, SLOT(thumbnailFailed(const QString&)));
 
     QObject::connect(&DeviceManager::getInstance(), SIGNAL(deviceAdded(CasparDevice&)), this, SLOT(deviceAdded(CasparDevice&)));
     const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
@@ -123,6 +125,27 @@ void RundownImageScrollerWidget::deviceChanged(const DeviceChangedEvent& event)
     checkDeviceConnection();
 }
 
+void RundownImageScrollerWidget::thumbnailChanged(const ThumbnailChangedEvent& event)
+{
+    if (event.getDeviceName() != this->model.getDeviceName() || !event.getNames().contains(this->model.getName()))
+        return;
+
+    setThumbnail();
+}
+
+void RundownImageScrollerWidget::thumbnailDecoded(const QString& key)
+{
+    if (key == this->thumbnailKey)
+        this->labelThumbnail->setPixmap(ThumbnailStore::getInstance().getPixmap(key, this->labelThumbnail->size()));
+}
+
+void RundownImageScrollerWidget::thumbnailFailed(const QString& key)
+{
+    // Move the item to the front of the thumbnail retrieval.
+    if (key == this->thumbnailKey)
+        EventManager::getInstance().fireThumbnailRequestedEvent(ThumbnailRequestedEvent(this->model.getDeviceName(), this->model.getName()));
+}
+
 AbstractRundownWidget* RundownImageScrollerWidget::clone()
 {
     RundownImageScrollerWidget* widget = new RundownImageScrollerWidget(this->model, this->parentWidget(), this->color,
@@ -204,21 +227,25 @@ void RundownImageScrollerWidget::setThumbnail()
         return;
     }
 
-    QString data = DatabaseManager::getInstance().getThumbnailByNameAndDeviceName(this->model.getName(), this->model.getDeviceName()).getData();
+    QString key = DatabaseManager::getInstance().getThumbnailByNameAndDeviceName(this->model.getName(), this->model.getDeviceName()).getData();
 
     /*
-    QString data = DatabaseManager::getInstance().getThumbnailById(this->model.getThumbnailId()).getData();
-    if (data.isEmpty())
-        data = DatabaseManager::getInstance().getThumbnailByNameAndDeviceName(this->model.getName(), this->model.getDeviceName()).getData();
+    QString key = DatabaseManager::getInstance().getThumbnailById(this->model.getThumbnailId()).getData();
+    if (key.isEmpty())
+        key = DatabaseManager::getInstance().getThumbnailByNameAndDeviceName(this->model.getName(), this->model.getDeviceName()).getData();
     */
 
-    QImage image;
-    image.loadFromData(QByteArray::fromBase64(data.toLatin1()), "PNG");
-    this->labelThumbnail->setPixmap(QPixmap::fromImage(image));
+    // Stays empty until the thumbnail is decoded.
+    this->thumbnailKey = key;
+    this->labelThumbnail->setPixmap(ThumbnailStore::getInstance().getPixmap(key, this->labelThumbnail->size()));
+
+    // Move the item to the front of the thumbnail retrieval.
+    if (key.isEmpty() || ThumbnailStore::getInstance().hasFailed(key))
+        EventManager::getInstance().fireThumbnailRequestedEvent(ThumbnailRequestedEvent(this->model.getDeviceName(), this->model.getName()));
 
     bool displayThumbnailTooltip = (DatabaseManager::getInstance().getConfigurationByName("ShowThumbnailTooltip").getValue() == "true") ? true : false;
     if (displayThumbnailTooltip)
-        this->labelThumbnail->setToolTip(QString("<img src=\"data:image/png;base64,%1 \"/>").arg(data));
+        this->labelThumbnail->setToolTip(QString("<img src=\"%1\"/>").arg(QUrl::fromLocalFile(ThumbnailStore::getInstance().getPath(key)).toString()));
 }
 
 void RundownImageScrollerWidget::setSelected(bool selected)
@@ -357,19 +384,8 @@ void RundownImageScrollerWidget::executeStop()
 {
     this->executeTimer.stop();
 
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-        device->stop(this->command.getChannel(), this->command.getVideolayer());
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-            deviceShadow->stop(this->command.getChannel(), this->command.getVideolayer());
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    device->stop(this->command.getChannel(), this->command.getVideolayer());
 
     this->paused = false;
     this->loaded = false;
@@ -378,33 +394,13 @@ void RundownImageScrollerWidget::executeStop()
 
 void RundownImageScrollerWidget::executePlay()
 {
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-    {
-        if (this->loaded)
-            device->play(this->command.getChannel(), this->command.getVideolayer());
-        else
-            device->playImageScroll(this->command.getChannel(), this->command.getVideolayer(), this->command.getImageScrollerName(),
-                                    this->command.getBlur(), this->command.getSpeed(), this->command.getPremultiply(),
-                                    this->command.getProgressive());
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice>  deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            if (this->loaded)
-                deviceShadow->play(this->command.getChannel(), this->command.getVideolayer());
-            else
-                deviceShadow->playImageScroll(this->command.getChannel(), this->command.getVideolayer(), this->command.getImageScrollerName(),
-                                              this->command.getBlur(), this->command.getSpeed(), this->command.getPremultiply(),
-                                              this->command.getProgressive());
-        }
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    if (this->loaded)
+        device->play(this->command.getChannel(), this->command.getVideolayer());
+    else
+        device->playImageScroll(this->command.getChannel(), this->command.getVideolayer(), this->command.getImageScrollerName(),
+                                this->command.getBlur(), this->command.getSpeed(), this->command.getPremultiply(),
+                                this->command.getProgressive());
 
     if (this->markUsedItems)
         setUsed(true);
@@ -419,56 +415,21 @@ void RundownImageScrollerWidget::executePause()
     if (!this->playing)
         return;
 
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-    {
-        if (this->paused)
-            device->resume(this->command.getChannel(), this->command.getVideolayer());
-        else
-            device->pause(this->command.getChannel(), this->command.getVideolayer());
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            if (this->paused)
-                deviceShadow->resume(this->command.getChannel(), this->command.getVideolayer());
-            else
-                deviceShadow->pause(this->command.getChannel(), this->command.getVideolayer());
-        }
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    if (this->paused)
+        device->resume(this->command.getChannel(), this->command.getVideolayer());
+    else
+        device->pause(this->command.getChannel(), this->command.getVideolayer());
 
     this->paused = !this->paused;
 }
 
 void RundownImageScrollerWidget::executeLoad()
 {
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-    {
-        device->loadImageScroll(this->command.getChannel(), this->command.getVideolayer(), this->command.getImageScrollerName(),
-                                this->command.getBlur(), this->command.getSpeed(), this->command.getPremultiply(),
-                                this->command.getProgressive());
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice>  deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            deviceShadow->loadImageScroll(this->command.getChannel(), this->command.getVideolayer(), this->command.getImageScrollerName(),
-                                          this->command.getBlur(), this->command.getSpeed(), this->command.getPremultiply(),
-                                          this->command.getProgressive());
-        }
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    device->loadImageScroll(this->command.getChannel(), this->command.getVideolayer(), this->command.getImageScrollerName(),
+                            this->command.getBlur(), this->command.getSpeed(), this->command.getPremultiply(),
+                            this->command.getProgressive());
 
     this->loaded = true;
     this->paused = false;
@@ -479,19 +440,8 @@ void RundownImageScrollerWidget::executeClearVideolayer()
 {
     this->executeTimer.stop();
 
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-        device->clearVideolayer(this->command.getChannel(), this->command.getVideolayer());
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-            deviceShadow->clearVideolayer(this->command.getChannel(), this->command.getVideolayer());
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    device->clearVideolayer(this->command.getChannel(), this->command.getVideolayer());
 
     this->paused = false;
     this->loaded = false;
@@ -502,25 +452,9 @@ void RundownImageScrollerWidget::executeClearChannel()
 {
     this->executeTimer.stop();
 
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-    {
-        device->clearChannel(this->command.getChannel());
-        device->clearMixerChannel(this->command.getChannel());
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            deviceShadow->clearChannel(this->command.getChannel());
-            deviceShadow->clearMixerChannel(this->command.getChannel());
-        }
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    device->clearChannel(this->command.getChannel());
+    device->clearMixerChannel(this->command.getChannel());
 
     this->paused = false;
     this->loaded = false;
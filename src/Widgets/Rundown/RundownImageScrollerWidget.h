@@ -18,6 +18,7 @@
 #include "Events/Inspector/DeviceChangedEvent.h"
 #include "Events/Inspector/LabelChangedEvent.h"
 #include "Events/Inspector/TargetChangedEvent.h"
+#include "Events/ThumbnailChangedEvent.h"
 #include "Models/LibraryModel.h"
 
 #include <QtCore/QString>
@@ -68,6 +69,7 @@ class WIDGETS_EXPORT RundownImageScrollerWidget : public QWidget, Ui::RundownIma
         ImageScrollerCommand command;
         ActiveAnimation* animation;
         QString delayType;
+        QString thumbnailKey;
         bool markUsedItems;
         bool selected = false;
 
@@ -113,4 +115,7 @@ class WIDGETS_EXPORT RundownImageScrollerWidget : public QWidget, Ui::RundownIma
         Q_SLOT void labelChanged(const LabelChangedEvent&);
         Q_SLOT void targetChanged(const TargetChangedEvent&);
         Q_SLOT void deviceChanged(const DeviceChangedEvent&);
+        Q_SLOT void thumbnailChanged(const ThumbnailChangedEvent&);
+        Q_SLOT void thumbnailDecoded(const QString&);
+        Q_SLOT void thumbnailFailed(const QString&);
 };
@@ -5,6 +5,8 @@
 #include "DatabaseManager.h"
 #include "DeviceManager.h"
 #include "GpiManager.h"
+#include "OscDeviceManager.h"
+#include "ThumbnailStore.h"
 #include "EventManager.h"
 #include "Events/ConnectionStateChangedEvent.h"
 #include "Events/Rundown/AutoPlayRundownItemEvent.h"
@@ -13,6 +15,7 @@
 
 #include <QtCore/QObject>
 #include <QtCore/QFileInfo>
+#include <QtCore/QUrl>
 
 #include <QtGui/QPixmap>
 
@@ -22,8 +25,7 @@ RundownMovieWidget::RundownMovieWidget(const LibraryModel& model, QWidget* paren
                                        bool loaded, bool paused, bool playing, bool inGroup, bool compactView)
     : QWidget(parent),
       active(active), loaded(loaded), paused(paused), playing(playing), inGroup(inGroup), compactView(compactView), color(color), model(model),
-      reverseOscTime(false), sendAutoPlay(false), hasSentAutoPlay(false), useFreezeOnLoad(false), fileModel(NULL), timeSubscription(NULL),
-      frameSubscription(NULL), fpsSubscription(NULL), pathSubscription(NULL), pausedSubscription(NULL), loopSubscription(NULL), stopControlSubscription(NULL),
+      reverseOscTime(false), sendAutoPlay(false), hasSentAutoPlay(false), useFreezeOnLoad(false), playbackState(NULL), stopControlSubscription(NULL),
       playControlSubscription(NULL), playNowControlSubscription(NULL), loadControlSubscription(NULL), pauseControlSubscription(NULL), nextControlSubscription(NULL),
       updateControlSubscription(NULL), previewControlSubscription(NULL), clearControlSubscription(NULL), clearVideolayerControlSubscription(NULL), clearChannelControlSubscription(NULL)
 {
@@ -66,13 +68,12 @@ RundownMovieWidget::RundownMovieWidget(const LibraryModel& model, QWidget* paren
     QObject::connect(&this->command, SIGNAL(loopChanged(bool)), this, SLOT(loopChanged(bool)));
     QObject::connect(&this->command, SIGNAL(autoPlayChanged(bool)), this, SLOT(autoPlayChanged(bool)));
     QObject::connect(&this->command, SIGNAL(remoteTriggerIdChanged(const QString&)), this, SLOT(remoteTriggerIdChanged(const QString&)));
-    QObject::connect(&EventManager::getInstance(), SIGNAL(deviceChanged(const DeviceChangedEvent&)), this, SLOT(deviceChanged(const DeviceChangedEvent&)));
-    QObject::connect(&EventManager::getInstance(), SIGNAL(targetChanged(const TargetChangedEvent&)), this, SLOT(targetChanged(const TargetChangedEvent&)));
-    QObject::connect(&EventManager::getInstance(), SIGNAL(labelChanged(const LabelChangedEvent&)), this, SLOT(labelChanged(const LabelChangedEvent&)));
-    QObject::connect(&EventManager::getInstance(), SIGNAL(videolayerChanged(const VideolayerChangedEvent&)), this, SLOT(videolayerChanged(const VideolayerChangedEvent&)));
-    QObject::connect(&EventManager::getInstance(), SIGNAL(channelChanged(const ChannelChangedEvent&)), this, SLOT(channelChanged(const ChannelChangedEvent&)));
+    QObject::connect(&EventManager::getInstance(), SIGNAL(thumbnailChanged(const ThumbnailChangedEvent&)), this, SLOT(thumbnailChanged(const ThumbnailChangedEvent&)));
+    QObject::connect(&ThumbnailStore::getInstance(), SIGNAL(thumbnailDecoded(const QString&)), this, SLOT(thumbnailDecoded(const QString&)));
+    QObject::connect(&ThumbnailStore::getInstance(), SIGNAL(thumbnailFailed(const QString&)), this, SLOT(thumbnailFailed(const QString&)));
 
     QObject::connect(&DeviceManager::getInstance(), SIGNAL(deviceAdded(CasparDevice&)), this, SLOT(deviceAdded(CasparDevice&)));
+    QObject::connect(&DeviceManager::getInstance(), SIGNAL(deviceAddressChanged(CasparDevice&)), this, SLOT(deviceAddressChanged(CasparDevice&)));
     const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
     if (device != NULL)
         QObject::connect(device.data(), SIGNAL(connectionStateChanged(CasparDevice&)), this, SLOT(deviceConnectionStateChanged(CasparDevice&)));
@@ -163,6 +164,27 @@ void RundownMovieWidget::deviceChanged(const DeviceChangedEvent& event)
     configureOscSubscriptions();
 }
 
+void RundownMovieWidget::thumbnailChanged(const ThumbnailChangedEvent& event)
+{
+    if (event.getDeviceName() != this->model.getDeviceName() || !event.getNames().contains(this->model.getName()))
+        return;
+
+    setThumbnail();
+}
+
+void RundownMovieWidget::thumbnailDecoded(const QString& key)
+{
+    if (key == this->thumbnailKey)
+        this->labelThumbnail->setPixmap(ThumbnailStore::getInstance().getPixmap(key, this->labelThumbnail->size()));
+}
+
+void RundownMovieWidget::thumbnailFailed(const QString& key)
+{
+    // Move the item to the front of the thumbnail retrieval.
+    if (key == this->thumbnailKey)
+        EventManager::getInstance().fireThumbnailRequestedEvent(ThumbnailRequestedEvent(this->model.getDeviceName(), this->model.getName()));
+}
+
 AbstractRundownWidget* RundownMovieWidget::clone()
 {
     RundownMovieWidget* widget = new RundownMovieWidget(this->model, this->parentWidget(), this->color, this->active,
@@ -257,21 +279,25 @@ void RundownMovieWidget::setThumbnail()
         return;
     }
 
-    QString data = DatabaseManager::getInstance().getThumbnailByNameAndDeviceName(this->model.getName(), this->model.getDeviceName()).getData();
+    QString key = DatabaseManager::getInstance().getThumbnailByNameAndDeviceName(this->model.getName(), this->model.getDeviceName()).getData();
 
     /*
-    QString data = DatabaseManager::getInstance().getThumbnailById(this->model.getThumbnailId()).getData();
-    if (data.isEmpty())
-        data = DatabaseManager::getInstance().getThumbnailByNameAndDeviceName(this->model.getName(), this->model.getDeviceName()).getData();
+    QString key = DatabaseManager::getInstance().getThumbnailById(this->model.getThumbnailId()).getData();
+    if (key.isEmpty())
+        key = DatabaseManager::getInstance().getThumbnailByNameAndDeviceName(this->model.getName(), this->model.getDeviceName()).getData();
     */
 
-    QImage image;
-    image.loadFromData(QByteArray::fromBase64(data.toLatin1()), "PNG");
-    this->labelThumbnail->setPixmap(QPixmap::fromImage(image));
+    // Stays empty until the thumbnail is decoded.
+    this->thumbnailKey = key;
+    this->labelThumbnail->setPixmap(ThumbnailStore::getInstance().getPixmap(key, this->labelThumbnail->size()));
+
+    // Move the item to the front of the thumbnail retrieval.
+    if (key.isEmpty() || ThumbnailStore::getInstance().hasFailed(key))
+        EventManager::getInstance().fireThumbnailRequestedEvent(ThumbnailRequestedEvent(this->model.getDeviceName(), this->model.getName()));
 
     bool displayThumbnailTooltip = (DatabaseManager::getInstance().getConfigurationByName("ShowThumbnailTooltip").getValue() == "true") ? true : false;
     if (displayThumbnailTooltip)
-        this->labelThumbnail->setToolTip(QString("<img src=\"data:image/png;base64,%1 \"/>").arg(data));
+        this->labelThumbnail->setToolTip(QString("<img src=\"%1\"/>").arg(QUrl::fromLocalFile(ThumbnailStore::getInstance().getPath(key)).toString()));
 }
 
 void RundownMovieWidget::setSelected(bool selected)
@@ -492,61 +518,26 @@ void RundownMovieWidget::executeStop()
 
 void RundownMovieWidget::executePlay()
 {
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    if (this->loaded)
+    {
+        device->play(this->command.getChannel(), this->command.getVideolayer());
+    }
+    else
     {
-        if (this->loaded)
+        if (this->command.getAutoPlay())
         {
-            device->play(this->command.getChannel(), this->command.getVideolayer());
+            device->playMovie(this->command.getChannel(), this->command.getVideolayer(), this->command.getVideoName(),
+                              this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
+                              this->command.getDirection(), this->command.getSeek(), this->command.getLength(),
+                              this->command.getLoop(), true);
         }
         else
         {
-            if (this->command.getAutoPlay())
-            {
-                device->playMovie(this->command.getChannel(), this->command.getVideolayer(), this->command.getVideoName(),
-                                  this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                                  this->command.getDirection(), this->command.getSeek(), this->command.getLength(),
-                                  this->command.getLoop(), true);
-            }
-            else
-            {
-                device->playMovie(this->command.getChannel(), this->command.getVideolayer(), this->command.getVideoName(),
-                                  this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                                  this->command.getDirection(), this->command.getSeek(), this->command.getLength(),
-                                  this->command.getLoop(), this->command.getAutoPlay());
-            }
-        }
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice>  deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            if (this->loaded)
-            {
-                deviceShadow->play(this->command.getChannel(), this->command.getVideolayer());
-            }
-            else
-            {
-                if (this->command.getAutoPlay())
-                {
-                    deviceShadow->playMovie(this->command.getChannel(), this->command.getVideolayer(), this->command.getVideoName(),
-                                            this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                                            this->command.getDirection(), this->command.getSeek(), this->command.getLength(),
-                                            this->command.getLoop(), true);
-                }
-                else
-                {
-                    deviceShadow->playMovie(this->command.getChannel(), this->command.getVideolayer(), this->command.getVideoName(),
-                                            this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                                            this->command.getDirection(), this->command.getSeek(), this->command.getLength(),
-                                            this->command.getLoop(), this->command.getAutoPlay());
-                }
-            }
+            device->playMovie(this->command.getChannel(), this->command.getVideolayer(), this->command.getVideoName(),
+                              this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
+                              this->command.getDirection(), this->command.getSeek(), this->command.getLength(),
+                              this->command.getLoop(), this->command.getAutoPlay());
         }
     }
 
@@ -567,29 +558,11 @@ void RundownMovieWidget::executePause()
     if (!this->playing)
         return;
 
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-    {
-        if (this->paused)
-            device->resume(this->command.getChannel(), this->command.getVideolayer());
-        else
-            device->pause(this->command.getChannel(), this->command.getVideolayer());
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            if (this->paused)
-                deviceShadow->resume(this->command.getChannel(), this->command.getVideolayer());
-            else
-                deviceShadow->pause(this->command.getChannel(), this->command.getVideolayer());
-        }
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    if (this->paused)
+        device->resume(this->command.getChannel(), this->command.getVideolayer());
+    else
+        device->pause(this->command.getChannel(), this->command.getVideolayer());
 
     this->paused = !this->paused;
 
@@ -598,29 +571,11 @@ void RundownMovieWidget::executePause()
 
 void RundownMovieWidget::executeLoad()
 {
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-    {
-        device->loadMovie(this->command.getChannel(), this->command.getVideolayer(), this->command.getVideoName(),
-                          this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                          this->command.getDirection(), this->command.getSeek(), this->command.getLength(),
-                          this->command.getLoop(), this->command.getFreezeOnLoad(), false);
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice>  deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            deviceShadow->loadMovie(this->command.getChannel(), this->command.getVideolayer(), this->command.getVideoName(),
-                                    this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                                    this->command.getDirection(), this->command.getSeek(), this->command.getLength(),
-                                    this->command.getLoop(), this->command.getFreezeOnLoad(), false);
-        }
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    device->loadMovie(this->command.getChannel(), this->command.getVideolayer(), this->command.getVideoName(),
+                      this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
+                      this->command.getDirection(), this->command.getSeek(), this->command.getLength(),
+                      this->command.getLoop(), this->command.getFreezeOnLoad(), false);
 
     this->loaded = true;
     this->paused = false;
@@ -666,30 +621,11 @@ void RundownMovieWidget::executeNext()
 {
     if (this->command.getAutoPlay())
     {
-        const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-        if (device != NULL && device->isConnected())
-        {
-            device->playMovie(this->command.getChannel(), this->command.getVideolayer(), this->command.getVideoName(),
-                              this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                              this->command.getDirection(), this->command.getSeek(), this->command.getLength(),
-                              this->command.getLoop(), false);
-
-        }
-
-        foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-        {
-            if (model.getShadow() == "No")
-                continue;
-
-            const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-            if (deviceShadow != NULL && deviceShadow->isConnected())
-            {
-                deviceShadow->playMovie(this->command.getChannel(), this->command.getVideolayer(), this->command.getVideoName(),
-                                        this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                                        this->command.getDirection(), this->command.getSeek(), this->command.getLength(),
-                                        this->command.getLoop(), false);
-            }
-        }
+        const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+        device->playMovie(this->command.getChannel(), this->command.getVideolayer(), this->command.getVideoName(),
+                          this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
+                          this->command.getDirection(), this->command.getSeek(), this->command.getLength(),
+                          this->command.getLoop(), false);
 
         this->paused = false;
         this->loaded = false;
@@ -821,71 +757,25 @@ void RundownMovieWidget::configureOscSubscriptions()
     if (DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName()) == NULL)
             return;
 
-    if (this->timeSubscription != NULL)
-        this->timeSubscription->disconnect(); // Disconnect all events.
-
-    if (this->frameSubscription != NULL)
-        this->frameSubscription->disconnect(); // Disconnect all events.
-
-    if (this->fpsSubscription != NULL)
-        this->fpsSubscription->disconnect(); // Disconnect all events.
-
-    if (this->pathSubscription != NULL)
-        this->pathSubscription->disconnect(); // Disconnect all events.
-
-    if (this->pausedSubscription != NULL)
-        this->pausedSubscription->disconnect(); // Disconnect all events.
-
-    if (this->loopSubscription != NULL)
-        this->loopSubscription->disconnect(); // Disconnect all events.
-
-    QString timeFilter = Osc::DEFAULT_TIME_FILTER;
-    timeFilter.replace("#IPADDRESS#", QString("%1").arg(DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName())->resolveIpAddress()))
-              .replace("#CHANNEL#", QString("%1").arg(this->command.getChannel()))
-              .replace("#VIDEOLAYER#", QString("%1").arg(this->command.getVideolayer()));
-    this->timeSubscription = new OscSubscription(timeFilter, this);
-    QObject::connect(this->timeSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(timeSubscriptionReceived(const QString&, const QList<QVariant>&)));
-
-    QString frameFilter = Osc::DEFAULT_FRAME_FILTER;
-    frameFilter.replace("#IPADDRESS#", QString("%1").arg(DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName())->resolveIpAddress()))
-               .replace("#CHANNEL#", QString("%1").arg(this->command.getChannel()))
-               .replace("#VIDEOLAYER#", QString("%1").arg(this->command.getVideolayer()));
-    this->frameSubscription = new OscSubscription(frameFilter, this);
-    QObject::connect(this->frameSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(frameSubscriptionReceived(const QString&, const QList<QVariant>&)));
-
-    QString fpsFilter = Osc::DEFAULT_FPS_FILTER;
-    fpsFilter.replace("#IPADDRESS#", QString("%1").arg(DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName())->resolveIpAddress()))
-             .replace("#CHANNEL#", QString("%1").arg(this->command.getChannel()))
-             .replace("#VIDEOLAYER#", QString("%1").arg(this->command.getVideolayer()));
-    this->fpsSubscription = new OscSubscription(fpsFilter, this);
-    QObject::connect(this->fpsSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(fpsSubscriptionReceived(const QString&, const QList<QVariant>&)));
-
-    QString pathFilter = Osc::DEFAULT_PATH_FILTER;
-    pathFilter.replace("#IPADDRESS#", QString("%1").arg(DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName())->resolveIpAddress()))
-              .replace("#CHANNEL#", QString("%1").arg(this->command.getChannel()))
-              .replace("#VIDEOLAYER#", QString("%1").arg(this->command.getVideolayer()));
-    this->pathSubscription = new OscSubscription(pathFilter, this);
-    QObject::connect(this->pathSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(pathSubscriptionReceived(const QString&, const QList<QVariant>&)));
-
-    QString pausedFilter = Osc::DEFAULT_PAUSED_FILTER;
-    pausedFilter.replace("#IPADDRESS#", QString("%1").arg(DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName())->resolveIpAddress()))
-                .replace("#CHANNEL#", QString("%1").arg(this->command.getChannel()))
-                .replace("#VIDEOLAYER#", QString("%1").arg(this->command.getVideolayer()));
-    this->pausedSubscription = new OscSubscription(pausedFilter, this);
-    QObject::connect(this->pausedSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(pausedSubscriptionReceived(const QString&, const QList<QVariant>&)));
-
-    QString loopFilter = Osc::DEFAULT_LOOP_FILTER;
-    loopFilter.replace("#IPADDRESS#", QString("%1").arg(DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName())->resolveIpAddress()))
-              .replace("#CHANNEL#", QString("%1").arg(this->command.getChannel()))
-              .replace("#VIDEOLAYER#", QString("%1").arg(this->command.getVideolayer()));
-    this->loopSubscription = new OscSubscription(loopFilter, this);
-    QObject::connect(this->loopSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(loopSubscriptionReceived(const QString&, const QList<QVariant>&)));
+    // The playback state is keyed on the server address, it is bound when the address is resolved. The control
+    // subscriptions below do not depend on it.
+    if (this->playbackState != NULL)
+    {
+        this->playbackState->disconnect(this);
+        this->playbackState = NULL;
+    }
+
+    const QString address = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName())->resolveIpAddress();
+    if (!address.isEmpty())
+    {
+        this->playbackState = OscDeviceManager::getInstance().getPlaybackState(address, this->command.getChannel(), this->command.getVideolayer());
+        QObject::connect(this->playbackState, SIGNAL(stateChanged()), this, SLOT(playbackStateChanged()));
+
+        // The state may already be known, e.g. a paused clip that will not change again. States are never cleared,
+        // only apply one the server still reports.
+        if (this->playbackState->isCurrent())
+            playbackStateChanged();
+    }
 
     if (!this->command.getAllowRemoteTriggering())
         return;
@@ -1052,70 +942,40 @@ void RundownMovieWidget::deviceAdded(CasparDevice& device)
     configureOscSubscriptions();
 }
 
-void RundownMovieWidget::timeSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void RundownMovieWidget::deviceAddressChanged(CasparDevice& device)
 {
-    Q_UNUSED(predicate);
-
-    if (this->fileModel != NULL)
-    {
-        delete this->fileModel;
-        this->fileModel = NULL;
-    }
-
-    this->fileModel = new OscFileModel();
-    this->fileModel->setTime(arguments.at(0).toDouble());
-    this->fileModel->setTotalTime(arguments.at(1).toDouble());
-}
-
-void RundownMovieWidget::frameSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
-{
-    Q_UNUSED(predicate);
-
-    if (this->fileModel == NULL)
+    if (DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName()).data() != &device)
         return;
 
-    this->fileModel->setFrame(arguments.at(0).toInt());
-    this->fileModel->setTotalFrames(arguments.at(1).toInt());
+    configureOscSubscriptions();
 }
 
-void RundownMovieWidget::fpsSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void RundownMovieWidget::playbackStateChanged()
 {
-    Q_UNUSED(predicate);
-
-    if (this->fileModel == NULL)
-        return;
+    this->widgetOscTime->setPaused(this->playbackState->isPaused());
+    this->widgetOscTime->setLoop(this->playbackState->isLoop());
 
-    this->fileModel->setFramesPerSecond(arguments.at(0).toDouble());
-}
+    const OscFileModel& file = this->playbackState->getFile();
 
-void RundownMovieWidget::pathSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
-{
-    Q_UNUSED(predicate);
-
-    QString name = arguments.at(0).toString();
+    QString name = file.getPath();
     name.remove(name.lastIndexOf('.'), name.length()); // Remove extension.
 
     if (this->model.getName().toLower() != name.toLower())
         return; // Wrong file.
 
-    if (this->fileModel == NULL)
-        return;
+    this->widgetOscTime->setProgress(file.getFrame());
 
-    this->fileModel->setPath(arguments.at(0).toString());
-
-    this->widgetOscTime->setProgress(this->fileModel->getFrame());
-
-    if (this->reverseOscTime && this->fileModel->getFrame() > 0)
-        this->widgetOscTime->setTime(this->fileModel->getTotalFrames() - this->fileModel->getFrame());
+    if (this->reverseOscTime && file.getFrame() > 0)
+        this->widgetOscTime->setTime(file.getTotalFrames() - file.getFrame());
     else
-        this->widgetOscTime->setTime(this->fileModel->getFrame());
+        this->widgetOscTime->setTime(file.getFrame());
 
     if (this->command.getSeek() == 0 && this->command.getLength() == 0)
-        this->widgetOscTime->setInOutTime(0, this->fileModel->getTotalFrames());
+        this->widgetOscTime->setInOutTime(0, file.getTotalFrames());
     else
         this->widgetOscTime->setInOutTime(this->command.getSeek(), this->command.getLength());
 
-    this->widgetOscTime->setFramesPerSecond(this->fileModel->getFramesPerSecond());
+    this->widgetOscTime->setFramesPerSecond(file.getFramesPerSecond());
 
     if (this->sendAutoPlay && !this->hasSentAutoPlay)
     {
@@ -1130,20 +990,6 @@ void RundownMovieWidget::pathSubscriptionReceived(const QString& predicate, cons
     this->playing = true;
 }
 
-void RundownMovieWidget::pausedSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
-{
-    Q_UNUSED(predicate);
-
-    this->widgetOscTime->setPaused(arguments.at(0).toBool());
-}
-
-void RundownMovieWidget::loopSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
-{
-    Q_UNUSED(predicate);
-
-    this->widgetOscTime->setLoop(arguments.at(0).toBool());
-}
-
 void RundownMovieWidget::autoPlayChanged(bool autoPlay)
 {
     this->labelAutoPlay->setVisible(autoPlay);
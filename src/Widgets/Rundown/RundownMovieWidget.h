@@ -11,6 +11,7 @@
 #include "GpiDevice.h"
 
 #include "OscSubscription.h"
+#include "PlaybackState.h"
 #include "Animations/ActiveAnimation.h"
 #include "Commands/AbstractCommand.h"
 #include "Commands/AbstractPlayoutCommand.h"
@@ -19,9 +20,9 @@
 #include "Events/Inspector/DeviceChangedEvent.h"
 #include "Events/Inspector/LabelChangedEvent.h"
 #include "Events/Inspector/TargetChangedEvent.h"
+#include "Events/ThumbnailChangedEvent.h"
 #include "Events/Inspector/VideolayerChangedEvent.h"
 #include "Models/LibraryModel.h"
-#include "Models/OscFileModel.h"
 
 #include <QtCore/QString>
 #include <QtCore/QTimer>
@@ -74,17 +75,12 @@ class WIDGETS_EXPORT RundownMovieWidget : public QWidget, Ui::RundownMovieWidget
         bool sendAutoPlay;
         bool hasSentAutoPlay;
         QString delayType;
+        QString thumbnailKey;
         bool markUsedItems;
         bool useFreezeOnLoad;
         bool selected = false;
 
-        OscFileModel* fileModel;
-        OscSubscription* timeSubscription;
-        OscSubscription* frameSubscription;
-        OscSubscription* fpsSubscription;
-        OscSubscription* pathSubscription;
-        OscSubscription* pausedSubscription;
-        OscSubscription* loopSubscription;
+        PlaybackState* playbackState;
 
         OscSubscription* stopControlSubscription;
         OscSubscription* playControlSubscription;
@@ -125,12 +121,8 @@ class WIDGETS_EXPORT RundownMovieWidget : public QWidget, Ui::RundownMovieWidget
         Q_SLOT void remoteTriggerIdChanged(const QString&);
         Q_SLOT void deviceConnectionStateChanged(CasparDevice&);
         Q_SLOT void deviceAdded(CasparDevice&);
-        Q_SLOT void timeSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void frameSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void fpsSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void pathSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void pausedSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void loopSubscriptionReceived(const QString&, const QList<QVariant>&);
+        Q_SLOT void deviceAddressChanged(CasparDevice&);
+        Q_SLOT void playbackStateChanged();
         Q_SLOT void autoPlayChanged(bool);
         Q_SLOT void stopControlSubscriptionReceived(const QString&, const QList<QVariant>&);
         Q_SLOT void playControlSubscriptionReceived(const QString&, const QList<QVariant>&);
@@ -148,4 +140,7 @@ class WIDGETS_EXPORT RundownMovieWidget : public QWidget, Ui::RundownMovieWidget
         Q_SLOT void labelChanged(const LabelChangedEvent&);
         Q_SLOT void targetChanged(const TargetChangedEvent&);
         Q_SLOT void deviceChanged(const DeviceChangedEvent&);
+        Q_SLOT void thumbnailChanged(const ThumbnailChangedEvent&);
+        Q_SLOT void thumbnailDecoded(const QString&);
+        Q_SLOT void thumbnailFailed(const QString&);
 };
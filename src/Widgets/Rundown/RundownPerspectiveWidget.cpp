@@ -52,8 +52,6 @@ RundownPerspectiveWidget::RundownPerspectiveWidget(const LibraryModel& model, QW
     QObject::connect(&this->command, SIGNAL(allowGpiChanged(bool)), this, SLOT(allowGpiChanged(bool)));
     QObject::connect(&this->command, SIGNAL(remoteTriggerIdChanged(const QString&)), this, SLOT(remoteTriggerIdChanged(const QString&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(preview(const PreviewEvent&)), this, SLOT(preview(const PreviewEvent&)));
-    QObject::connect(&EventManager::getInstance(), SIGNAL(deviceChanged(const DeviceChangedEvent&)), this, SLOT(deviceChanged(const DeviceChangedEvent&)));
-    QObject::connect(&EventManager::getInstance(), SIGNAL(labelChanged(const LabelChangedEvent&)), this, SLOT(labelChanged(const LabelChangedEvent&)));
 
     QObject::connect(&DeviceManager::getInstance(), SIGNAL(deviceAdded(CasparDevice&)), this, SLOT(deviceAdded(CasparDevice&)));
     const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
@@ -318,44 +316,18 @@ void RundownPerspectiveWidget::executeStop()
 {
     this->executeTimer.stop();
 
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-        device->setPerspective(this->command.getChannel(), this->command.getVideolayer(), 0, 0, 1, 0, 1, 1, 0, 1);
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-            deviceShadow->setPerspective(this->command.getChannel(), this->command.getVideolayer(), 0, 0, 1, 0, 1, 1, 0, 1);
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    device->setPerspective(this->command.getChannel(), this->command.getVideolayer(), 0, 0, 1, 0, 1, 1, 0, 1);
 }
 
 void RundownPerspectiveWidget::executePlay()
 {
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-        device->setPerspective(this->command.getChannel(), this->command.getVideolayer(), this->command.getUpperLeftX(),
-                               this->command.getUpperLeftY(), this->command.getUpperRightX(), this->command.getUpperRightY(),
-                               this->command.getLowerRightX(), this->command.getLowerRightY(), this->command.getLowerLeftX(),
-                               this->command.getLowerLeftY(), this->command.getTransitionDuration(), this->command.getTween(),
-                               this->command.getDefer(), this->command.getUseMipmap());
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice>  deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-            deviceShadow->setPerspective(this->command.getChannel(), this->command.getVideolayer(), this->command.getUpperLeftX(),
-                                         this->command.getUpperLeftY(), this->command.getUpperRightX(), this->command.getUpperRightY(),
-                                         this->command.getLowerRightX(), this->command.getLowerRightY(), this->command.getLowerLeftX(),
-                                         this->command.getLowerLeftY(), this->command.getTransitionDuration(), this->command.getTween(),
-                                         this->command.getDefer(), this->command.getUseMipmap());
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    device->setPerspective(this->command.getChannel(), this->command.getVideolayer(), this->command.getUpperLeftX(),
+                           this->command.getUpperLeftY(), this->command.getUpperRightX(), this->command.getUpperRightY(),
+                           this->command.getLowerRightX(), this->command.getLowerRightY(), this->command.getLowerLeftX(),
+                           this->command.getLowerLeftY(), this->command.getTransitionDuration(), this->command.getTween(),
+                           this->command.getDefer(), this->command.getUseMipmap());
 
     if (this->markUsedItems)
         setUsed(true);
@@ -365,44 +337,17 @@ void RundownPerspectiveWidget::executeClearVideolayer()
 {
     this->executeTimer.stop();
 
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-        device->clearMixerVideolayer(this->command.getChannel(), this->command.getVideolayer());
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-            deviceShadow->clearMixerVideolayer(this->command.getChannel(), this->command.getVideolayer());
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    device->clearMixerVideolayer(this->command.getChannel(), this->command.getVideolayer());
 }
 
 void RundownPerspectiveWidget::executeClearChannel()
 {
     this->executeTimer.stop();
 
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-    {
-        device->clearChannel(this->command.getChannel());
-        device->clearMixerChannel(this->command.getChannel());
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            deviceShadow->clearChannel(this->command.getChannel());
-            deviceShadow->clearMixerChannel(this->command.getChannel());
-        }
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    device->clearChannel(this->command.getChannel());
+    device->clearMixerChannel(this->command.getChannel());
 }
 
 void RundownPerspectiveWidget::channelChanged(int channel)
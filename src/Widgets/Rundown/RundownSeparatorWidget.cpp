@@ -30,7 +30,6 @@ RundownSeparatorWidget::RundownSeparatorWidget(const LibraryModel& model, QWidge
 
     this->labelLabel->setText(this->model.getLabel());
 
-    QObject::connect(&EventManager::getInstance(), SIGNAL(labelChanged(const LabelChangedEvent&)), this, SLOT(labelChanged(const LabelChangedEvent&)));
 }
 
 void RundownSeparatorWidget::labelChanged(const LabelChangedEvent& event)
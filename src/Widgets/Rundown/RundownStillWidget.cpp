@@ -5,6 +5,7 @@
 #include "DatabaseManager.h"
 #include "DeviceManager.h"
 #include "GpiManager.h"
+#include "ThumbnailStore.h"
 #include "EventManager.h"
 #include "Events/ConnectionStateChangedEvent.h"
 
@@ -12,6 +13,7 @@
 
 #include <QtCore/QObject>
 #include <QtCore/QTimer>
+#include <QtCore/QUrl>
 
 #include <QtWidgets/QGraphicsOpacityEffect>
 
@@ -56,9 +58,9 @@ RundownStillWidget::RundownStillWidget(const LibraryModel& model, QWidget* paren
     QObject::connect(&this->command, SIGNAL(delayChanged(int)), this, SLOT(delayChanged(int)));
     QObject::connect(&this->command, SIGNAL(allowGpiChanged(bool)), this, SLOT(allowGpiChanged(bool)));
     QObject::connect(&this->command, SIGNAL(remoteTriggerIdChanged(const QString&)), this, SLOT(remoteTriggerIdChanged(const QString&)));
-    QObject::connect(&EventManager::getInstance(), SIGNAL(deviceChanged(const DeviceChangedEvent&)), this, SLOT(deviceChanged(const DeviceChangedEvent&)));
-    QObject::connect(&EventManager::getInstance(), SIGNAL(targetChanged(const TargetChangedEvent&)), this, SLOT(targetChanged(const TargetChangedEvent&)));
-    QObject::connect(&EventManager::getInstance(), SIGNAL(labelChanged(const LabelChangedEvent&)), this, SLOT(labelChanged(const LabelChangedEvent&)));
+    QObject::connect(&EventManager::getInstance(), SIGNAL(thumbnailChanged(const ThumbnailChangedEvent&)), this, SLOT(thumbnailChanged(const ThumbnailChangedEvent&)));
+    QObject::connect(&ThumbnailStore::getInstance(), SIGNAL(thumbnailDecoded(const QString&)), this, SLOT(thumbnailDecoded(const QString&)));
+    QObject::connect(&ThumbnailStore::getInstance(), SIGNAL(thumbnailFailed(const QString&)), this, SLOT(thumbnailFailed(const QString&)));
 
     QObject::connect(&DeviceManager::getInstance(), SIGNAL(deviceAdded(CasparDevice&)), this, SLOT(deviceAdded(CasparDevice&)));
     const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
@@ -122,6 +124,27 @@ void RundownStillWidget::deviceChanged(const DeviceChangedEvent& event)
     checkDeviceConnection();
 }
 
+void RundownStillWidget::thumbnailChanged(const ThumbnailChangedEvent& event)
+{
+    if (event.getDeviceName() != this->model.getDeviceName() || !event.getNames().contains(this->model.getName()))
+        return;
+
+    setThumbnail();
+}
+
+void RundownStillWidget::thumbnailDecoded(const QString& key)
+{
+    if (key == this->thumbnailKey)
+        this->labelThumbnail->setPixmap(ThumbnailStore::getInstance().getPixmap(key, this->labelThumbnail->size()));
+}
+
+void RundownStillWidget::thumbnailFailed(const QString& key)
+{
+    // Move the item to the front of the thumbnail retrieval.
+    if (key == this->thumbnailKey)
+        EventManager::getInstance().fireThumbnailRequestedEvent(ThumbnailRequestedEvent(this->model.getDeviceName(), this->model.getName()));
+}
+
 AbstractRundownWidget* RundownStillWidget::clone()
 {
     RundownStillWidget* widget = new RundownStillWidget(this->model, this->parentWidget(), this->color,
@@ -199,21 +222,25 @@ LibraryModel* RundownStillWidget::getLibraryModel()
 
 void RundownStillWidget::setThumbnail()
 {
-    QString data = DatabaseManager::getInstance().getThumbnailByNameAndDeviceName(this->model.getName(), this->model.getDeviceName()).getData();
+    QString key = DatabaseManager::getInstance().getThumbnailByNameAndDeviceName(this->model.getName(), this->model.getDeviceName()).getData();
 
     /*
-    QString data = DatabaseManager::getInstance().getThumbnailById(this->model.getThumbnailId()).getData();
-    if (data.isEmpty())
-        data = DatabaseManager::getInstance().getThumbnailByNameAndDeviceName(this->model.getName(), this->model.getDeviceName()).getData();
+    QString key = DatabaseManager::getInstance().getThumbnailById(this->model.getThumbnailId()).getData();
+    if (key.isEmpty())
+        key = DatabaseManager::getInstance().getThumbnailByNameAndDeviceName(this->model.getName(), this->model.getDeviceName()).getData();
     */
 
-    QImage image;
-    image.loadFromData(QByteArray::fromBase64(data.toLatin1()), "PNG");
-    this->labelThumbnail->setPixmap(QPixmap::fromImage(image));
+    // Stays empty until the thumbnail is decoded.
+    this->thumbnailKey = key;
+    this->labelThumbnail->setPixmap(ThumbnailStore::getInstance().getPixmap(key, this->labelThumbnail->size()));
+
+    // Move the item to the front of the thumbnail retrieval.
+    if (key.isEmpty() || ThumbnailStore::getInstance().hasFailed(key))
+        EventManager::getInstance().fireThumbnailRequestedEvent(ThumbnailRequestedEvent(this->model.getDeviceName(), this->model.getName()));
 
     bool displayThumbnailTooltip = (DatabaseManager::getInstance().getConfigurationByName("ShowThumbnailTooltip").getValue() == "true") ? true : false;
     if (displayThumbnailTooltip)
-        this->labelThumbnail->setToolTip(QString("<img src=\"data:image/png;base64,%1 \"/>").arg(data));
+        this->labelThumbnail->setToolTip(QString("<img src=\"%1\"/>").arg(QUrl::fromLocalFile(ThumbnailStore::getInstance().getPath(key)).toString()));
 }
 
 void RundownStillWidget::setSelected(bool selected)
@@ -390,33 +417,13 @@ void RundownStillWidget::executeStop()
 
 void RundownStillWidget::executePlay()
 {
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-    {
-        if (this->loaded)
-            device->play(this->command.getChannel(), this->command.getVideolayer());
-        else
-            device->playStill(this->command.getChannel(), this->command.getVideolayer(), this->command.getImageName(),
-                              this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                              this->command.getDirection(), this->command.getUseAuto());
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice>  deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            if (this->loaded)
-                deviceShadow->play(this->command.getChannel(), this->command.getVideolayer());
-            else
-                deviceShadow->playStill(this->command.getChannel(), this->command.getVideolayer(), this->command.getImageName(),
-                                        this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                                        this->command.getDirection(), this->command.getUseAuto());
-        }
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    if (this->loaded)
+        device->play(this->command.getChannel(), this->command.getVideolayer());
+    else
+        device->playStill(this->command.getChannel(), this->command.getVideolayer(), this->command.getImageName(),
+                          this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
+                          this->command.getDirection(), this->command.getUseAuto());
 
     if (this->markUsedItems)
         setUsed(true);
@@ -463,56 +470,21 @@ void RundownStillWidget::executePause()
     if (!this->playing)
         return;
 
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-    {
-        if (this->paused)
-            device->play(this->command.getChannel(), this->command.getVideolayer());
-        else
-            device->pause(this->command.getChannel(), this->command.getVideolayer());
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            if (this->paused)
-                deviceShadow->play(this->command.getChannel(), this->command.getVideolayer());
-            else
-                deviceShadow->pause(this->command.getChannel(), this->command.getVideolayer());
-        }
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    if (this->paused)
+        device->play(this->command.getChannel(), this->command.getVideolayer());
+    else
+        device->pause(this->command.getChannel(), this->command.getVideolayer());
 
     this->paused = !this->paused;
 }
 
 void RundownStillWidget::executeLoad()
 {
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-    {
-        device->loadStill(this->command.getChannel(), this->command.getVideolayer(), this->command.getImageName(),
-                          this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                          this->command.getDirection(), this->command.getUseAuto());
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice>  deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            deviceShadow->loadStill(this->command.getChannel(), this->command.getVideolayer(), this->command.getImageName(),
-                                    this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                                    this->command.getDirection(), this->command.getUseAuto());
-        }
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    device->loadStill(this->command.getChannel(), this->command.getVideolayer(), this->command.getImageName(),
+                      this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
+                      this->command.getDirection(), this->command.getUseAuto());
 
     this->loaded = true;
     this->paused = false;
@@ -16,6 +16,7 @@
 #include "Commands/AbstractPlayoutCommand.h"
 #include "Commands/StillCommand.h"
 #include "Events/Inspector/TargetChangedEvent.h"
+#include "Events/ThumbnailChangedEvent.h"
 #include "Events/Inspector/LabelChangedEvent.h"
 #include "Events/Inspector/DeviceChangedEvent.h"
 #include "Models/LibraryModel.h"
@@ -68,6 +69,7 @@ class WIDGETS_EXPORT RundownStillWidget : public QWidget, Ui::RundownStillWidget
         StillCommand command;
         ActiveAnimation* animation;
         QString delayType;
+        QString thumbnailKey;
         bool markUsedItems;
         bool selected = false;
 
@@ -116,4 +118,7 @@ class WIDGETS_EXPORT RundownStillWidget : public QWidget, Ui::RundownStillWidget
         Q_SLOT void labelChanged(const LabelChangedEvent&);
         Q_SLOT void targetChanged(const TargetChangedEvent&);
         Q_SLOT void deviceChanged(const DeviceChangedEvent&);
+        Q_SLOT void thumbnailChanged(const ThumbnailChangedEvent&);
+        Q_SLOT void thumbnailDecoded(const QString&);
+        Q_SLOT void thumbnailFailed(const QString&);
 };
@@ -59,9 +59,6 @@ RundownTemplateWidget::RundownTemplateWidget(const LibraryModel& model, QWidget*
     QObject::connect(&this->command, SIGNAL(flashlayerChanged(int)), this, SLOT(flashlayerChanged(int)));
     QObject::connect(&this->command, SIGNAL(allowGpiChanged(bool)), this, SLOT(allowGpiChanged(bool)));
     QObject::connect(&this->command, SIGNAL(remoteTriggerIdChanged(const QString&)), this, SLOT(remoteTriggerIdChanged(const QString&)));
-    QObject::connect(&EventManager::getInstance(), SIGNAL(deviceChanged(const DeviceChangedEvent&)), this, SLOT(deviceChanged(const DeviceChangedEvent&)));
-    QObject::connect(&EventManager::getInstance(), SIGNAL(targetChanged(const TargetChangedEvent&)), this, SLOT(targetChanged(const TargetChangedEvent&)));
-    QObject::connect(&EventManager::getInstance(), SIGNAL(labelChanged(const LabelChangedEvent&)), this, SLOT(labelChanged(const LabelChangedEvent&)));
 
     QObject::connect(&DeviceManager::getInstance(), SIGNAL(deviceAdded(CasparDevice&)), this, SLOT(deviceAdded(CasparDevice&)));
     const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
@@ -498,46 +495,19 @@ void RundownTemplateWidget::executeStopPreview()
 
 void RundownTemplateWidget::executePlay()
 {
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    if (this->loaded)
     {
-        if (this->loaded)
-        {
-            device->playTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer());
-        }
-        else
-        {
-            if (this->command.getTemplateData().isEmpty())
-                device->playTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer(),
-                                     this->command.getTemplateName());
-            else
-                device->playTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer(),
-                                     this->command.getTemplateName(), this->command.getTemplateData());
-        }
+        device->playTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer());
     }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+    else
     {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice>  deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            if (this->loaded)
-            {
-                deviceShadow->playTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer());
-            }
-            else
-            {
-                if (this->command.getTemplateData().isEmpty())
-                    deviceShadow->playTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer(),
-                                               this->command.getTemplateName());
-                else
-                    deviceShadow->playTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer(),
-                                               this->command.getTemplateName(), this->command.getTemplateData());
-            }
-        }
+        if (this->command.getTemplateData().isEmpty())
+            device->playTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer(),
+                                 this->command.getTemplateName());
+        else
+            device->playTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer(),
+                                 this->command.getTemplateName(), this->command.getTemplateData());
     }
 
     if (this->markUsedItems)
@@ -586,94 +556,35 @@ void RundownTemplateWidget::executePlayPreview()
 
 void RundownTemplateWidget::executeLoad()
 {
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-    {
-        if (this->command.getTemplateData().isEmpty())
-            device->addTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer(),
-                                this->command.getTemplateName(), false);
-        else
-            device->addTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer(),
-                                this->command.getTemplateName(), false, this->command.getTemplateData());
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice>  deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            if (this->command.getTemplateData().isEmpty())
-                deviceShadow->addTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer(),
-                                          this->command.getTemplateName(), false);
-            else
-                deviceShadow->addTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer(),
-                                          this->command.getTemplateName(), false, this->command.getTemplateData());
-        }
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    if (this->command.getTemplateData().isEmpty())
+        device->addTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer(),
+                            this->command.getTemplateName(), false);
+    else
+        device->addTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer(),
+                            this->command.getTemplateName(), false, this->command.getTemplateData());
 
     this->loaded = true;
 }
 
 void RundownTemplateWidget::executeNext()
 {
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-        device->nextTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer());
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-            deviceShadow->nextTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer());
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    device->nextTemplate(this->command.getChannel(), this->command.getVideolayer(), this->command.getFlashlayer());
 }
 
 void RundownTemplateWidget::executeUpdate()
 {
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-    {
-        device->updateTemplate(this->command.getChannel(), this->command.getVideolayer(),
-                               this->command.getFlashlayer(), this->command.getTemplateData());
-    }
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            deviceShadow->updateTemplate(this->command.getChannel(), this->command.getVideolayer(),
-                                         this->command.getFlashlayer(), this->command.getTemplateData());
-        }
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    device->updateTemplate(this->command.getChannel(), this->command.getVideolayer(),
+                           this->command.getFlashlayer(), this->command.getTemplateData());
 }
 
 void RundownTemplateWidget::executeInvoke()
 {
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
-    if (device != NULL && device->isConnected())
-        device->invokeTemplate(this->command.getChannel(), this->command.getVideolayer(),
-                               this->command.getFlashlayer(), this->command.getInvoke());
-
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
-    {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-            deviceShadow->invokeTemplate(this->command.getChannel(), this->command.getVideolayer(),
-                                         this->command.getFlashlayer(), this->command.getInvoke());
-    }
+    const QSharedPointer<CasparDeviceGroup> device = DeviceManager::getInstance().getBroadcastGroupByName(this->model.getDeviceName());
+    device->invokeTemplate(this->command.getChannel(), this->command.getVideolayer(),
+                           this->command.getFlashlayer(), this->command.getInvoke());
 }
 
 void RundownTemplateWidget::executeClear()
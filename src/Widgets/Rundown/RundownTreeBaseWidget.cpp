@@ -14,6 +14,7 @@
 #include <iostream>
 
 #include <QtCore/QTime>
+#include <QtCore/QXmlStreamReader>
 #include <QtCore/QDebug>
 
 #include <QtGui/QDrag>
@@ -183,66 +184,188 @@ bool RundownTreeBaseWidget::pasteSelectedItems(bool repositoryRundown)
 
     EventManager::getInstance().fireRepositoryRundownEvent(RepositoryRundownEvent(repositoryRundown));
 
+    beginBulkInsert();
+
     BOOST_FOREACH(boost::property_tree::wptree::value_type& parentValue, pt.get_child(L"items"))
     {
         if (parentValue.first != L"item")
             continue;
 
-        AbstractRundownWidget* parentWidget = readProperties(parentValue.second);
+        insertItem(parentValue.second, offset);
+    }
 
-        int row  = QTreeWidget::currentIndex().row();
+    endBulkInsert();
 
-        QTreeWidgetItem* parentItem = new QTreeWidgetItem();
-        if (QTreeWidget::currentItem() == NULL || QTreeWidget::currentItem()->parent() == NULL) // Top level item.
+    checkEmptyRundown();
+
+    return true;
+}
+
+bool RundownTreeBaseWidget::readRundown(const QByteArray& data, bool repositoryRundown)
+{
+    QXmlStreamReader reader(data);
+    if (!reader.readNextStartElement() || reader.name() != "items")
+    {
+        qWarning("Unable to read rundown: %s", qPrintable(reader.errorString()));
+        return false;
+    }
+
+    // Items are created as they are read, only the properties of the current item are held in a tree.
+    beginBulkInsert();
+
+    int offset = 1; // Drop offset.
+    int progress = -1;
+    bool hasSentRepositoryRundown = false;
+    while (reader.readNextStartElement())
+    {
+        if (reader.name() == "allowremotetriggering")
         {
-            parentWidget->setInGroup(false);
-            parentWidget->setExpanded(false);
-
-            // If we don't have a selected row then we add the item to the bottom of the
-            // rundown. This can be the case when we drag and drop a preset to the rundown.
-            if (row != -1)
-                QTreeWidget::invisibleRootItem()->insertChild(row + offset++, parentItem);
-            else
-                QTreeWidget::invisibleRootItem()->addChild(parentItem);
+            QString value = reader.readElementText();
+            EventManager::getInstance().fireAllowRemoteTriggeringEvent(AllowRemoteTriggeringEvent(value == "true" || value == "1"));
+
+            continue;
         }
-        else
-        {
-            if (parentWidget->isGroup())
-                continue; // We don't support group in groups.
 
-            parentWidget->setInGroup(true);
+        if (!hasSentRepositoryRundown)
+        {
+            EventManager::getInstance().fireRepositoryRundownEvent(RepositoryRundownEvent(repositoryRundown));
+            hasSentRepositoryRundown = true;
+        }
 
-            QTreeWidget::currentItem()->parent()->insertChild(row + offset++, parentItem);
+        if (reader.name() != "item")
+        {
+            reader.skipCurrentElement();
+            continue;
         }
 
-        QTreeWidget::setItemWidget(parentItem, 0, dynamic_cast<QWidget*>(parentWidget));
-        //QTreeWidget::setCurrentItem(parentItem);
+        boost::property_tree::wptree pt;
+        readElement(reader, pt);
+        insertItem(pt, offset);
 
-        if (parentWidget->isGroup())
+        int percent = qMin(100, static_cast<int>(reader.characterOffset() * 100 / qMax(1, data.size())));
+        if (percent != progress)
         {
-            bool expanded = parentValue.second.get(L"expanded", false);
-            parentItem->setExpanded(expanded);
-            parentWidget->setExpanded(expanded);
+            // No events are processed while reading, remote triggers and timers can not reach a half built rundown.
+            // The status bar is repainted synchronously instead.
+            progress = percent;
+            EventManager::getInstance().fireStatusbarEvent(StatusbarEvent(QString("Opening rundown... %1%").arg(percent)));
+        }
+    }
 
-            BOOST_FOREACH(boost::property_tree::wptree::value_type& childValue, parentValue.second.get_child(L"items"))
-            {
-                AbstractRundownWidget* childWidget = readProperties(childValue.second);
-                childWidget->setInGroup(true);
+    if (!hasSentRepositoryRundown)
+        EventManager::getInstance().fireRepositoryRundownEvent(RepositoryRundownEvent(repositoryRundown));
 
-                QTreeWidgetItem* childItem = new QTreeWidgetItem();
-                parentItem->addChild(childItem);
+    endBulkInsert();
 
-                QTreeWidget::setItemWidget(childItem, 0, dynamic_cast<QWidget*>(childWidget));
-            }
+    if (reader.hasError())
+        qWarning("Error while reading rundown at line %lld: %s", reader.lineNumber(), qPrintable(reader.errorString()));
+
+    checkEmptyRundown();
+
+    return !reader.hasError();
+}
+
+void RundownTreeBaseWidget::readElement(QXmlStreamReader& reader, boost::property_tree::wptree& pt) const
+{
+    // Builds the same tree as boost::property_tree::xml_parser for the element the reader is positioned on.
+    QString text;
+    bool hasChildren = false;
+    while (!reader.atEnd())
+    {
+        QXmlStreamReader::TokenType token = reader.readNext();
+        if (token == QXmlStreamReader::StartElement)
+        {
+            boost::property_tree::wptree& child = pt.push_back(boost::property_tree::wptree::value_type(reader.name().toString().toStdWString(),
+                                                                                                      boost::property_tree::wptree()))->second;
+            readElement(reader, child);
+
+            hasChildren = true;
         }
+        else if (token == QXmlStreamReader::Characters)
+        {
+            text.append(reader.text());
+        }
+        else if (token == QXmlStreamReader::EndElement)
+        {
+            break;
+        }
+    }
+
+    if (!hasChildren)
+        pt.put_value(text.toStdWString());
+}
+
+void RundownTreeBaseWidget::insertItem(boost::property_tree::wptree& pt, int& offset)
+{
+    AbstractRundownWidget* parentWidget = readProperties(pt);
 
-        QTreeWidget::doItemsLayout(); // Refresh
-        QTreeWidget::repaint();
+    int row  = QTreeWidget::currentIndex().row();
+
+    bool topLevel = (QTreeWidget::currentItem() == NULL || QTreeWidget::currentItem()->parent() == NULL);
+    if (!topLevel && parentWidget->isGroup())
+    {
+        delete dynamic_cast<QWidget*>(parentWidget);
+        return; // We don't support group in groups.
     }
 
-    checkEmptyRundown();
+    QTreeWidgetItem* parentItem = new QTreeWidgetItem();
+    if (topLevel)
+    {
+        parentWidget->setInGroup(false);
+        parentWidget->setExpanded(false);
 
-    return true;
+        // If we don't have a selected row then we add the item to the bottom of the
+        // rundown. This can be the case when we drag and drop a preset to the rundown.
+        if (row != -1)
+            QTreeWidget::invisibleRootItem()->insertChild(row + offset++, parentItem);
+        else
+            QTreeWidget::invisibleRootItem()->addChild(parentItem);
+    }
+    else
+    {
+        parentWidget->setInGroup(true);
+
+        QTreeWidget::currentItem()->parent()->insertChild(row + offset++, parentItem);
+    }
+
+    QTreeWidget::setItemWidget(parentItem, 0, dynamic_cast<QWidget*>(parentWidget));
+    //QTreeWidget::setCurrentItem(parentItem);
+
+    if (parentWidget->isGroup())
+    {
+        bool expanded = pt.get(L"expanded", false);
+        parentItem->setExpanded(expanded);
+        parentWidget->setExpanded(expanded);
+
+        BOOST_FOREACH(boost::property_tree::wptree::value_type& childValue, pt.get_child(L"items"))
+        {
+            AbstractRundownWidget* childWidget = readProperties(childValue.second);
+            childWidget->setInGroup(true);
+
+            QTreeWidgetItem* childItem = new QTreeWidgetItem();
+            parentItem->addChild(childItem);
+
+            QTreeWidget::setItemWidget(childItem, 0, dynamic_cast<QWidget*>(childWidget));
+        }
+    }
+}
+
+void RundownTreeBaseWidget::beginBulkInsert()
+{
+    if (this->bulkInsertDepth++ > 0)
+        return;
+
+    QTreeWidget::setUpdatesEnabled(false);
+}
+
+void RundownTreeBaseWidget::endBulkInsert()
+{
+    if (this->bulkInsertDepth == 0 || --this->bulkInsertDepth > 0)
+        return;
+
+    // Lay out and paint once for everything inserted since beginBulkInsert().
+    QTreeWidget::doItemsLayout(); // Refresh
+    QTreeWidget::setUpdatesEnabled(true);
 }
 
 bool RundownTreeBaseWidget::duplicateSelectedItems()
@@ -1024,6 +1147,8 @@ void RundownTreeBaseWidget::applyRepositoryChanges()
     // Get the current selected item story id.
     QString currentStoryId = currentItemStoryId();
 
+    beginBulkInsert();
+
     int index = 0;
     while (index < this->repositoryChanges.count())
     {
@@ -1044,6 +1169,8 @@ void RundownTreeBaseWidget::applyRepositoryChanges()
         this->repositoryChanges.removeAt(index);
     }
 
+    endBulkInsert();
+
     // Do we have updates which we can nott apply?
     if (this->repositoryChanges.count() > 0)
         checRepositoryChanges();
@@ -1155,9 +1282,6 @@ void RundownTreeBaseWidget::addRepositoryItem(const QString& storyId, const QStr
                 QTreeWidget::setItemWidget(childItem, 0, dynamic_cast<QWidget*>(childWidget));
             }
         }
-
-        QTreeWidget::doItemsLayout(); // Refresh
-        //QTreeWidget::repaint();
     }
 }
 
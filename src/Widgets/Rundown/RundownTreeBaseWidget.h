@@ -14,9 +14,11 @@
 #include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/xml_parser.hpp>
 
+#include <QtCore/QByteArray>
 #include <QtCore/QModelIndexList>
 #include <QtCore/QMimeData>
 #include <QtCore/QRect>
+#include <QtCore/QXmlStreamReader>
 #include <QtCore/QXmlStreamWriter>
 
 #include <QtGui/QDragEnterEvent>
@@ -47,6 +49,11 @@ class WIDGETS_EXPORT RundownTreeBaseWidget : public QTreeWidget
         void writeProperties(QTreeWidgetItem* item, QXmlStreamWriter* writer) const;
 
         bool pasteSelectedItems(bool repositoryRundown = false);
+        bool readRundown(const QByteArray& data, bool repositoryRundown = false);
+
+        // Inserts between these calls are laid out and painted once, at the end. Calls may nest.
+        void beginBulkInsert();
+        void endBulkInsert();
         bool pasteItemProperties();
         bool duplicateSelectedItems();
         bool copySelectedItems() const;
@@ -80,11 +87,14 @@ class WIDGETS_EXPORT RundownTreeBaseWidget : public QTreeWidget
         bool compactView;
         QString theme;
         bool lock;
+        int bulkInsertDepth = 0;
 
         QPoint dragStartPosition;
         QList<RepositoryChangeModel> repositoryChanges;
 
         QString currentItemStoryId();
+        void insertItem(boost::property_tree::wptree& pt, int& offset);
+        void readElement(QXmlStreamReader& reader, boost::property_tree::wptree& pt) const;
         void removeRepositoryItem(const QString& storyId);
         bool containsStoryId(const QString& storyId, const QString& data);
         void addRepositoryItem(const QString& storyId, const QString& data);
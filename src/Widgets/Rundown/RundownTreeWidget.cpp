@@ -45,9 +45,7 @@
 #include <QtCore/QDebug>
 #include <QtCore/QDir>
 #include <QtCore/QPoint>
-#include <QtCore/QTextCodec>
 #include <QtCore/QTime>
-#include <QtCore/QTextStream>
 #include <QtCore/QCryptographicHash>
 
 #include <QtGui/QClipboard>
@@ -62,7 +60,7 @@
 RundownTreeWidget::RundownTreeWidget(QWidget* parent)
     : QWidget(parent),
       active(false), enterPressed(false), allowRemoteRundownTriggering(false), repositoryRundown(false), previewOnAutoStep(false),
-      clearDelayedCommandsOnAutoStep(false), activeRundown(Rundown::DEFAULT_NAME), currentAutoPlayWidget(NULL), copyItem(NULL), currentPlayingItem(NULL), currentPlayingAutoStepItem(NULL),
+      clearDelayedCommandsOnAutoStep(false), deferMixerCommandsInGroups(false), activeRundown(Rundown::DEFAULT_NAME), currentAutoPlayWidget(NULL), copyItem(NULL), currentPlayingItem(NULL), currentPlayingAutoStepItem(NULL),
       upControlSubscription(NULL), downControlSubscription(NULL), playAndAutoStepControlSubscription(NULL), playNowAndAutoStepControlSubscription(NULL),
       playNowIfChannelControlSubscription(NULL), stopControlSubscription(NULL), playControlSubscription(NULL), playNowControlSubscription(NULL),
       loadControlSubscription(NULL), pauseControlSubscription(NULL), nextControlSubscription(NULL), updateControlSubscription(NULL), invokeControlSubscription(NULL),
@@ -73,6 +71,11 @@ RundownTreeWidget::RundownTreeWidget(QWidget* parent)
 
     this->previewOnAutoStep = (DatabaseManager::getInstance().getConfigurationByName("PreviewOnAutoStep").getValue() == "true") ? true : false;
     this->clearDelayedCommandsOnAutoStep = (DatabaseManager::getInstance().getConfigurationByName("ClearDelayedCommandsOnAutoStep").getValue() == "true") ? true : false;
+    this->deferMixerCommandsInGroups = (DatabaseManager::getInstance().getConfigurationByName("DeferMixerCommandsInGroups").getValue() == "true") ? true : false;
+
+    this->deviceBatchTimer.setSingleShot(true);
+    this->deviceBatchTimer.setInterval(0);
+    QObject::connect(&this->deviceBatchTimer, SIGNAL(timeout()), this, SLOT(endDeviceBatch()));
 
     QObject::connect(this->treeWidgetRundown, SIGNAL(customContextMenuRequested(const QPoint &)), this, SLOT(customContextMenuRequested(const QPoint &)));
 
@@ -103,6 +106,11 @@ RundownTreeWidget::RundownTreeWidget(QWidget* parent)
     this->treeWidgetRundown->checkEmptyRundown();
 }
 
+RundownTreeWidget::~RundownTreeWidget()
+{
+    endDeviceBatch();
+}
+
 void RundownTreeWidget::setupMenus()
 {
     this->contextMenuMixer = new QMenu(this);
@@ -610,26 +618,22 @@ void RundownTreeWidget::openRundown(const QString& path)
     {
         this->activeRundown = path;
 
-        QTextStream stream(&file);
-        stream.setCodec(QTextCodec::codecForName("UTF-8"));
+        QByteArray data = file.readAll();
+        file.close();
 
-        // Save the latest value stored in the clipboard.
-        QString latest = qApp->clipboard()->text();
-        QString data = stream.readAll();
+        if (data.startsWith("\xEF\xBB\xBF"))
+            data.remove(0, 3); // UTF-8 byte order mark.
 
-        this->hexHash = QString(QCryptographicHash::hash(data.toUtf8(), QCryptographicHash::Md5).toHex());
+        this->hexHash = QString(QCryptographicHash::hash(data, QCryptographicHash::Md5).toHex());
         qDebug("Hash is %s", qPrintable(this->hexHash));
 
-        qApp->clipboard()->setText(data);
-        pasteSelectedItems();
+        // Every item looks up its thumbnail while it is created.
+        DatabaseManager::getInstance().prefetchThumbnails();
 
-        // Set previous stored clipboard value.
-        qApp->clipboard()->setText(latest);
+        this->treeWidgetRundown->readRundown(data, this->repositoryRundown);
 
         qDebug("Parsing rundown completed in %d msec", time.elapsed());
 
-        file.close();
-
         if (this->treeWidgetRundown->invisibleRootItem()->childCount() > 0)
             this->treeWidgetRundown->setCurrentItem(this->treeWidgetRundown->invisibleRootItem()->child(0));
 
@@ -666,18 +670,14 @@ void RundownTreeWidget::doOpenRundownFromUrl(QNetworkReply* reply)
 {
     this->repositoryRundown = true;
 
-    // Save the latest value stored in the clipboard.
-    QString latest = qApp->clipboard()->text();
-    QString data = QString::fromUtf8(reply->readAll());
+    QByteArray data = reply->readAll();
 
-    this->hexHash = QString(QCryptographicHash::hash(data.toUtf8(), QCryptographicHash::Md5).toHex());
+    this->hexHash = QString(QCryptographicHash::hash(data, QCryptographicHash::Md5).toHex());
     qDebug("Hash is %s", qPrintable(this->hexHash));
 
-    qApp->clipboard()->setText(data);
-    pasteSelectedItems();
+    DatabaseManager::getInstance().prefetchThumbnails();
 
-    // Set previous stored clipboard value.
-    qApp->clipboard()->setText(latest);
+    this->treeWidgetRundown->readRundown(data, this->repositoryRundown);
 
     if (this->treeWidgetRundown->invisibleRootItem()->childCount() > 0)
         this->treeWidgetRundown->setCurrentItem(this->treeWidgetRundown->invisibleRootItem()->child(0));
@@ -1224,6 +1224,8 @@ bool RundownTreeWidget::executeCommand(Playout::PlayoutType type, Action::Action
 
     if (rundownWidget != nullptr && rundownWidget->isGroup())
     {
+        beginDeviceBatch(currentItem);
+
         if (type == Playout::PlayoutType::Next && dynamic_cast<GroupCommand*>(rundownWidget->getCommand())->getAutoPlay())
         {
             if (this->currentAutoPlayWidget != nullptr)
@@ -1297,9 +1299,15 @@ bool RundownTreeWidget::executeCommand(Playout::PlayoutType type, Action::Action
             }
 
             if (type == Playout::PlayoutType::Preview)
+            {
+                scheduleEndDeviceBatch();
+
                 return true; // We are done.
+            }
         }
 
+        scheduleEndDeviceBatch();
+
         // Setting: Should we AutoStep and send Preview on next item.
         if ((type != Playout::PlayoutType::Clear &&
              type != Playout::PlayoutType::ClearVideoLayer &&
@@ -1348,6 +1356,42 @@ bool RundownTreeWidget::executeCommand(Playout::PlayoutType type, Action::Action
     return true;
 }
 
+void RundownTreeWidget::beginDeviceBatch(QTreeWidgetItem* groupItem)
+{
+    // Only the channels the group plays on are held, other traffic to the same devices is not delayed.
+    QMap<QString, QStringList> channels;
+    for (int i = 0; i < groupItem->childCount(); i++)
+    {
+        AbstractRundownWidget* childWidget = dynamic_cast<AbstractRundownWidget*>(this->treeWidgetRundown->itemWidget(groupItem->child(i), 0));
+        if (childWidget == NULL || childWidget->getLibraryModel()->getDeviceName().isEmpty())
+            continue;
+
+        QStringList& deviceChannels = channels[childWidget->getLibraryModel()->getDeviceName()];
+        if (!deviceChannels.contains(QString::number(childWidget->getCommand()->getChannel())))
+            deviceChannels.append(QString::number(childWidget->getCommand()->getChannel()));
+    }
+
+    if (channels.isEmpty())
+        return;
+
+    this->deviceBatchTokens.append(DeviceManager::getInstance().beginBatch(channels, this->deferMixerCommandsInGroups));
+}
+
+void RundownTreeWidget::scheduleEndDeviceBatch()
+{
+    // Child items without delay execute from zero timers started above. Restarting our own zero timer after
+    // them keeps the batch open until they have all fired in the next event loop pass.
+    this->deviceBatchTimer.start();
+}
+
+void RundownTreeWidget::endDeviceBatch()
+{
+    foreach (int token, this->deviceBatchTokens)
+        DeviceManager::getInstance().endBatch(token);
+
+    this->deviceBatchTokens.clear();
+}
+
 void RundownTreeWidget::selectItemBelow()
 {
     this->treeWidgetRundown->selectItemBelow();
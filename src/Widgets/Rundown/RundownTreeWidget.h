@@ -37,6 +37,7 @@
 #include <QtCore/QMap>
 #include <QtCore/QObject>
 #include <QtCore/QString>
+#include <QtCore/QTimer>
 #include <QtCore/QXmlStreamWriter>
 #include <QtCore/QSharedPointer>
 
@@ -53,6 +54,7 @@ class WIDGETS_EXPORT RundownTreeWidget : public QWidget, Ui::RundownTreeWidget
 
     public:
         explicit RundownTreeWidget(QWidget* parent = 0);
+        ~RundownTreeWidget();
 
         void setActive(bool active);
         void openRundown(const QString& path);
@@ -76,6 +78,10 @@ class WIDGETS_EXPORT RundownTreeWidget : public QWidget, Ui::RundownTreeWidget
         bool repositoryRundown;
         bool previewOnAutoStep;
         bool clearDelayedCommandsOnAutoStep;
+        bool deferMixerCommandsInGroups;
+
+        QTimer deviceBatchTimer;
+        QList<int> deviceBatchTokens;
 
         QString page;
         QString activeRundown;
@@ -132,6 +138,8 @@ class WIDGETS_EXPORT RundownTreeWidget : public QWidget, Ui::RundownTreeWidget
         void resetOscSubscriptions();
         void configureOscSubscriptions();
         QString colorLookup(const QString& color, bool reverse) const;
+        void beginDeviceBatch(QTreeWidgetItem* groupItem);
+        void scheduleEndDeviceBatch();
 
         Q_SLOT void addAtemFadeToBlackItem();
         Q_SLOT void addPlayoutCommandItem();
@@ -199,6 +207,7 @@ class WIDGETS_EXPORT RundownTreeWidget : public QWidget, Ui::RundownTreeWidget
         Q_SLOT void itemClicked(QTreeWidgetItem*, int);
         Q_SLOT void itemSelectionChanged();
         Q_SLOT void contextMenuNewTriggered(QAction*);
+        Q_SLOT void endDeviceBatch();
         Q_SLOT void selectItemBelow();
         Q_SLOT void executePreview();
         Q_SLOT bool removeSelectedItems();
@@ -9,6 +9,7 @@
 
 #include "DatabaseManager.h"
 #include "GpiManager.h"
+#include "ThumbnailStore.h"
 #include "EventManager.h"
 #include "Events/OscOutputChangedEvent.h"
 #include "Events/Atem/AtemDeviceChangedEvent.h"
@@ -920,6 +921,7 @@ void SettingsDialog::deleteThumbnails()
     EventManager::getInstance().fireStatusbarEvent(StatusbarEvent("Deleting thumbnails..."));
 
     DatabaseManager::getInstance().deleteThumbnails();
+    ThumbnailStore::getInstance().clear();
 
     EventManager::getInstance().fireStatusbarEvent(StatusbarEvent(""));
 